@@ -0,0 +1,539 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Bitboard
+//*
+//* Move generation and move processing on the board masks.
+//*
+//************************************************************************************************************************
+#include "Bitboard.h"		// Bitboard types and functions.
+#include "Thread.h"			// The check for AVX2 can be made by several search threads at once.
+
+// Generated flip functions for each square of the board size being built.
+#if BOARDSIZE == 6
+#include "FlipKernels6.h"
+#elif BOARDSIZE == 10
+#include "FlipKernels10.h"
+#else
+#include "FlipKernels.h"
+#endif
+
+// Column and row steps for the 8 directions to search from a square.
+static const int dirX[8] = { -1,  1,  0,  0, -1,  1, -1,  1 };
+static const int dirY[8] = {  0,  0, -1,  1, -1,  1,  1, -1 };
+
+// Random keys for each square (enough for the 10x10 board), made with splitmix64 from seed 0x0123456789abcdef. The key of a
+// position is all the keys for its pieces XORed together, so a piece being added, removed or flipped is a single XOR.
+// Keys for a piece of the player to move.
+static const uint64_t zobristOwn[100] =
+{
+	0x157a3807a48faa9dULL, 0xd573529b34a1d093ULL, 0x2f90b72e996dccbeULL, 0xa2d419334c4667ecULL,
+	0x01404ce914938008ULL, 0x14bc574c2a2b4c72ULL, 0xb8fc5b1060708c05ULL, 0x8931545f4f9ea651ULL,
+	0xf984db4ef14fde1bULL, 0x2680d065cb73ece7ULL, 0xcdb8c9cd9a62da0fULL, 0x6a6e60fd5089adecULL,
+	0x8eba85b28df77747ULL, 0x97f6c69811cfb13bULL, 0x380e8b5c685039cfULL, 0xd7ebcca19d49c3f5ULL,
+	0x2ab8c4e395cb5958ULL, 0x0028babe93685d04ULL, 0x997f31f8a4cd9c80ULL, 0xd21d99f3172d8bacULL,
+	0x5a2b349fbc1e0ffeULL, 0x797f89de6e3f1828ULL, 0xe7175a23bfad7b92ULL, 0xf7e9ff7484731d95ULL,
+	0x5e4d770f93e9e90aULL, 0x54aa3f71e1f9a4eaULL, 0xd8c4ca1b231b3c6fULL, 0x591a77554620b3ddULL,
+	0x64516d7d46552c2cULL, 0x1d8a4e1ddb56c2dbULL, 0x09193ec65cf7a972ULL, 0x495647d3953b24f7ULL,
+	0x86228b0724bb8f48ULL, 0xa3c27a0df00dbde8ULL, 0xf7a2cc8df2b2c4f6ULL, 0x41a2ba708473bf43ULL,
+	0xe0a70cd4b524e9caULL, 0x3dfafd29d7a4f68aULL, 0xbfd57627fe350937ULL, 0xb17ca3f1d69ca979ULL,
+	0x8678f4068da8b694ULL, 0x7fb196e8fb85c9a8ULL, 0x537a638df1af2be9ULL, 0x374ca94be4ab03acULL,
+	0xa659ac05d6767b6fULL, 0x69f82a9d3ed5e971ULL, 0x1ace0042d1a810deULL, 0xda235af0bf25ccd2ULL,
+	0x42e5f9bb2b0f7f55ULL, 0x0f99757e2d864329ULL, 0xd9ad2a9fb910d391ULL, 0x6f3490f8eb9ad67aULL,
+	0x0a924a41bc96159fULL, 0x597bee355c27a849ULL, 0xfadc7d62c4f8c2f9ULL, 0x2e4496b33f12505cULL,
+	0x64ba359d52aed065ULL, 0x32db564112ce728cULL, 0x70e322977ff938d4ULL, 0x52e180e0ac6b7a34ULL,
+	0xb6b3a15184ea44d0ULL, 0xc79841f4a60c9b64ULL, 0x7820abc18567251aULL, 0x5f02b53e36acba13ULL,
+	0xa2e2dc50777382cfULL, 0xd81a99276724d05aULL, 0xfff9b035990df79eULL, 0x24f6d86191b20ba9ULL,
+	0xd51102a2c7585773ULL, 0xed265d05cef5b47dULL, 0xfdee78ec5defc377ULL, 0x7ac70965e7906465ULL,
+	0x37a671fd127a6c54ULL, 0x954b1d6bdb786d1dULL, 0x07327a7a3f4b631cULL, 0xe4fedf764227af0bULL,
+	0x30fe2ed17aeb7464ULL, 0x82e2207fff804bb7ULL, 0x4bfb1d8cf09f2fddULL, 0x6f41f50471dd2348ULL,
+	0x1914ebd7a144f08dULL, 0x9bb612999ae11e3eULL, 0x005b0833ff9747dbULL, 0x92902cfa584fb7d5ULL,
+	0x021090a209e6d3bbULL, 0x2062b1cf6848e0c0ULL, 0x2c97d3122731c9e4ULL, 0xaf9321d7a7cb3162ULL,
+	0x6f42e68457ca11cfULL, 0x62eac04effa4256fULL, 0x591d691f7c36f6ffULL, 0x438bf30884cdc34dULL,
+	0xb2a8d8135941cab2ULL, 0x3c1e538dd31fc0a9ULL, 0x8ef9c4afa0c12a7aULL, 0x759d4ff9a3dc6224ULL,
+	0xc7713465995b0cb6ULL, 0x6c3ace3ff294ea5cULL, 0xfe47b88520f317f0ULL, 0x72c13c6d8f72ee05ULL
+};
+
+// Keys for a piece of the opponent.
+static const uint64_t zobristOpp[100] =
+{
+	0x4f8cc00a7c35c9cdULL, 0x10ffabaa5debbf4aULL, 0xa6e6e5b256e1deb5ULL, 0xacd1ecfd1cc72b04ULL,
+	0xa5b90175b4ec43aeULL, 0xe7cf4ae1ccc855eeULL, 0x73d64ad3b2e02cddULL, 0x0b4183489d5776bdULL,
+	0x652ecbbc53a87ef9ULL, 0x9be2dfd6d2acc4a7ULL, 0x5b0c7cbc96c380ecULL, 0x50850db1cb25be56ULL,
+	0x4990b5ce127969e6ULL, 0x09fa827978ea6eeeULL, 0x3537a0e61b90eee7ULL, 0x86db39dcb2fb6e11ULL,
+	0xc8f40c4314a52908ULL, 0xa6b27d324e3b793bULL, 0x09c4191c27462006ULL, 0xd50aa1987fe53be1ULL,
+	0x9484f8415f453c2dULL, 0xd2629e2454b2ba59ULL, 0x0ebd226243d1c3baULL, 0x49a17debdb062ce4ULL,
+	0x6c1431e50abd8d9fULL, 0x9c8893820a8ef2c6ULL, 0x6baaadf7132aebabULL, 0x17588716e00d3d10ULL,
+	0xd4302d79eedc566bULL, 0x392727792b73f2f9ULL, 0x0f90ca483193f91bULL, 0x43856098c604fda6ULL,
+	0x2f98b506672f01f4ULL, 0xd7be1678182ff8f4ULL, 0x3203386b52595004ULL, 0xd0aaea03dd23ba41ULL,
+	0x564f1121abacd617ULL, 0x557de36f1b175b74ULL, 0x42808a00051a20acULL, 0x4e68e26636092c9aULL,
+	0xb5c5147f51b5c125ULL, 0x9c7409ad84e1ff9dULL, 0x6552968ef1406aaeULL, 0x94af045ec1eff5baULL,
+	0x776e4574e1c0b72aULL, 0x42368001538b7fedULL, 0xaab31e20d6676d4aULL, 0x1f2205e639faac75ULL,
+	0x976a031e6d1300fdULL, 0x3bc82a8cd8928101ULL, 0x64eb00451fcda6a0ULL, 0xae8069650951e6c7ULL,
+	0x9bf08b9136ea1f15ULL, 0x55e4c9e5ed5a1631ULL, 0x1dc7ebca191a4f9fULL, 0x9af60f805727a6ffULL,
+	0x3bc932dc7b55fcd9ULL, 0xf2cf5c832165f4d7ULL, 0x93e28a7fdad46acaULL, 0x2e81f57288b5a3fcULL,
+	0x77ee289cbd481d86ULL, 0x234bece6728d07bfULL, 0xfc43ba702952035fULL, 0x4beae957ae465fc1ULL,
+	0xa062698ad3a66babULL, 0x0b3751c3e39d3c13ULL, 0x6958c2f06445e0bdULL, 0x9c4c700026328479ULL,
+	0xf8cbc20116366778ULL, 0x9ff4e6e165c8264eULL, 0x237124ad782c0a79ULL, 0x0afd6032930133f0ULL,
+	0x20273835ae106835ULL, 0x3ac4288a828d01f4ULL, 0x1280ba85e43e7f73ULL, 0x0d50ebbef90cc176ULL,
+	0x349ffd38cb9dd55dULL, 0xb4ea10988b26801bULL, 0x55412129f90f095dULL, 0x60f5e26b538cb394ULL,
+	0x5d7f0d62a7389d15ULL, 0xd2f4a94efdc6d675ULL, 0x6d343ac45da111d6ULL, 0xf8419768052725bcULL,
+	0x8e37a31fdbe83debULL, 0xb568f29ddb496c83ULL, 0xed89da9018b2c149ULL, 0xca3f24698e995f17ULL,
+	0xd5ffc5744fe74fb3ULL, 0x19c2d92f321ad142ULL, 0x19f5a8750e0baafbULL, 0xb1d2da32648a9772ULL,
+	0xe5cef9d5593fd1afULL, 0x8dfda4d6915afe10ULL, 0x4d0b8e9526b88a53ULL, 0x442c3cd8bbeefd08ULL,
+	0x5d747632dfa14638ULL, 0x8a67c40616b1a783ULL, 0x8d778b030c888236ULL, 0x6202410110c3c053ULL
+};
+
+// Set up the starting four pieces in the middle of the board.
+void clearPosition(position_t* pos)
+{
+	const int m = BOARDSIZE / 2;	// Column and row just above and left of the middle.
+
+	pos->own = SQUAREBIT(SQUARE(m, m)) | SQUAREBIT(SQUARE(m + 1, m + 1));
+	pos->opp = SQUAREBIT(SQUARE(m + 1, m)) | SQUAREBIT(SQUARE(m, m + 1));
+	setKeys(pos);
+}
+
+// Work out both keys of a position from scratch.
+void setKeys(position_t* pos)
+{
+	pos->key = 0;
+	pos->swapKey = 0;
+	for (bitboard_t b = pos->own; b; b &= b - 1)
+	{
+		pos->key ^= zobristOwn[firstSquare(b)];
+		pos->swapKey ^= zobristOpp[firstSquare(b)];
+	}
+	for (bitboard_t b = pos->opp; b; b &= b - 1)
+	{
+		pos->key ^= zobristOpp[firstSquare(b)];
+		pos->swapKey ^= zobristOwn[firstSquare(b)];
+	}
+}
+
+// Opponent pieces that can be part of a line in a direction with a sideways step. Pieces on the left and right edges are left out,
+// as a line cannot carry on past them and the shifts would otherwise wrap round onto the next row.
+#define INNER (BOARDMASK & ~(COLUMN1 | COLUMNN))
+
+// Shifts to step one square in each direction.
+#define RIGHT		1
+#define DOWN		BOARDSIZE
+#define DOWNRIGHT	(BOARDSIZE + 1)
+#define DOWNLEFT	(BOARDSIZE - 1)
+
+// Fill from the player's pieces over the opponent pieces towards higher square numbers, doubling the distance covered at each step.
+// Three steps of 1, 2 and 4 squares cover the longest possible line of 6 opponent pieces on the 8x8 board, the 10x10 board needs
+// a fourth step for lines of 8.
+static inline bitboard_t fillUp(bitboard_t own, bitboard_t opp, int s)
+{
+	own |= opp & (own << s);
+	opp &= opp << s;
+	own |= opp & (own << (2 * s));
+	opp &= opp << (2 * s);
+	own |= opp & (own << (4 * s));
+#if BOARDSIZE > 8
+	opp &= opp << (4 * s);
+	own |= opp & (own << (8 * s));
+#endif
+	return own;
+}
+
+// Fill from the player's pieces over the opponent pieces towards lower square numbers.
+static inline bitboard_t fillDown(bitboard_t own, bitboard_t opp, int s)
+{
+	own |= opp & (own >> s);
+	opp &= opp >> s;
+	own |= opp & (own >> (2 * s));
+	opp &= opp >> (2 * s);
+	own |= opp & (own >> (4 * s));
+#if BOARDSIZE > 8
+	opp &= opp >> (4 * s);
+	own |= opp & (own >> (8 * s));
+#endif
+	return own;
+}
+
+// Find all the valid moves at once using parallel prefix (Kogge-Stone) fills in each of the 8 directions.
+// The opponent pieces reached by a fill are the lines that start with a player piece, so one more step along
+// the direction gives the squares that would close the line. Any of these that are empty are valid moves.
+bitboard_t getMovesScalar(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t inner = opp & INNER;
+	bitboard_t moves;
+
+	moves  = ((fillUp(own, inner, RIGHT) ^ own) << RIGHT);				// Right.
+	moves |= ((fillDown(own, inner, RIGHT) ^ own) >> RIGHT);			// Left.
+	moves |= ((fillUp(own, opp, DOWN) ^ own) << DOWN);					// Down.
+	moves |= ((fillDown(own, opp, DOWN) ^ own) >> DOWN);				// Up.
+	moves |= ((fillUp(own, inner, DOWNRIGHT) ^ own) << DOWNRIGHT);		// Down and right.
+	moves |= ((fillDown(own, inner, DOWNRIGHT) ^ own) >> DOWNRIGHT);	// Up and left.
+	moves |= ((fillUp(own, inner, DOWNLEFT) ^ own) << DOWNLEFT);		// Down and left.
+	moves |= ((fillDown(own, inner, DOWNLEFT) ^ own) >> DOWNLEFT);		// Up and right.
+
+	return moves & ~(own | opp) & BOARDMASK;	// Shifts down or right can go off the end of a board smaller than the bitboard.
+}
+
+// Whether to use the AVX2 versions of the functions, -1 until checked on first use.
+static int useAVX2 = -1;
+
+// Check once whether the processor supports AVX2. The first use can be on several threads at once, so the flag is read and
+// written atomically (each thread that finds it unchecked writes the same answer).
+static inline bool selectAVX2(void)
+{
+	int use = readShared(&useAVX2);
+
+	if (use < 0)
+	{
+		use = hasAVX2() ? 1 : 0;
+		writeShared(&useAVX2, use);
+	}
+	return (use != 0);
+}
+
+// Find all the valid moves, using the fastest version the processor supports.
+bitboard_t getMoves(bitboard_t own, bitboard_t opp)
+{
+	if (selectAVX2()) { return getMovesAVX2(own, opp); }
+	return getMovesScalar(own, opp);
+}
+
+// Get the flips for a move, using the fastest version the processor supports.
+bitboard_t getFlips(int sq, bitboard_t own, bitboard_t opp)
+{
+	if (selectAVX2()) { return getFlipsAVX2(sq, own, opp); }
+	return getFlipsScalar(sq, own, opp);
+}
+
+// Get the squares next to any of the squares in b, in any of the 8 directions.
+// A sideways shift must not reach the left or right column, as it would have wrapped round from the next row.
+bitboard_t getNeighbours(bitboard_t b)
+{
+	b |= ((b << RIGHT) & BOARDMASK & ~COLUMN1) | ((b >> RIGHT) & ~COLUMNN);	// Spread sideways first, then up and down to cover the diagonals too.
+	return (b | (b << DOWN) | (b >> DOWN)) & BOARDMASK;
+}
+
+// Number of valid moves for the player with the own pieces.
+int getMobility(bitboard_t own, bitboard_t opp)
+{
+	return bitCount(getMoves(own, opp));
+}
+
+// Number of empty squares next to an opponent piece, the squares that could become moves later on.
+int getPotentialMobility(bitboard_t own, bitboard_t opp)
+{
+	return bitCount(getNeighbours(opp) & ~(own | opp));	// The neighbours are all on the board, so no mask is needed.
+}
+
+// Number of the player's own pieces next to an empty square. Frontier pieces are the ones that give the opponent moves.
+int getFrontier(bitboard_t own, bitboard_t opp)
+{
+	return bitCount(getNeighbours(~(own | opp) & BOARDMASK) & own);
+}
+
+// Find the valid moves for each of a batch of positions, using the fastest version the processor supports.
+void getMovesBatch(int n, const bitboard_t* own, const bitboard_t* opp, bitboard_t* moves)
+{
+	if (selectAVX2()) { getMovesBatchAVX2(n, own, opp, moves); }
+	else { getMovesBatchScalar(n, own, opp, moves); }
+}
+
+// Get the flips for a move in each of a batch of positions, using the fastest version the processor supports.
+void getFlipsBatch(int n, const int* sq, const bitboard_t* own, const bitboard_t* opp, bitboard_t* flips)
+{
+	if (selectAVX2()) { getFlipsBatchAVX2(n, sq, own, opp, flips); }
+	else { getFlipsBatchScalar(n, sq, own, opp, flips); }
+}
+
+// Batch of positions one at a time, for processors without AVX2.
+void getMovesBatchScalar(int n, const bitboard_t* own, const bitboard_t* opp, bitboard_t* moves)
+{
+	for (int i = 0; i < n; i++) { moves[i] = getMovesScalar(own[i], opp[i]); }
+}
+
+void getFlipsBatchScalar(int n, const int* sq, const bitboard_t* own, const bitboard_t* opp, bitboard_t* flips)
+{
+	for (int i = 0; i < n; i++) { flips[i] = (sq[i] == PASS) ? 0 : getFlipsScalar(sq[i], own[i], opp[i]); }
+}
+
+#if BOARDSIZE == 8
+
+// Flip the board top to bottom, which reverses the order of the rows (bytes).
+static inline bitboard_t flipRows(bitboard_t b)
+{
+#if defined(__GNUC__)
+	return __builtin_bswap64(b);
+#else
+	b = ((b >> 8) & 0x00ff00ff00ff00ffULL) | ((b & 0x00ff00ff00ff00ffULL) << 8);
+	b = ((b >> 16) & 0x0000ffff0000ffffULL) | ((b & 0x0000ffff0000ffffULL) << 16);
+	return (b >> 32) | (b << 32);
+#endif
+}
+
+// Mirror the board left to right, reversing the bits of each row by swapping single bits, then pairs, then fours.
+static inline bitboard_t mirrorColumns(bitboard_t b)
+{
+	b = ((b >> 1) & 0x5555555555555555ULL) | ((b & 0x5555555555555555ULL) << 1);
+	b = ((b >> 2) & 0x3333333333333333ULL) | ((b & 0x3333333333333333ULL) << 2);
+	return ((b >> 4) & 0x0f0f0f0f0f0f0f0fULL) | ((b & 0x0f0f0f0f0f0f0f0fULL) << 4);
+}
+
+// Swap columns and rows. The 4x4 blocks either side of the diagonal are swapped, then the 2x2 blocks, then single squares.
+static inline bitboard_t swapXY(bitboard_t b)
+{
+	bitboard_t t;
+
+	t = 0x0f0f0f0f00000000ULL & (b ^ (b << 28));
+	b ^= t ^ (t >> 28);
+	t = 0x3333000033330000ULL & (b ^ (b << 14));
+	b ^= t ^ (t >> 14);
+	t = 0x5500550055005500ULL & (b ^ (b << 7));
+	return b ^ t ^ (t >> 7);
+}
+
+#else
+
+// The other board sizes are only used for tests on the PC, so the symmetries are done a square at a time.
+static bitboard_t flipRows(bitboard_t b)
+{
+	bitboard_t r = 0;
+
+	for (; b; b &= b - 1) { r |= SQUAREBIT(SQUARE(SQUAREX(firstSquare(b)), BOARDSIZE + 1 - SQUAREY(firstSquare(b)))); }
+	return r;
+}
+
+static bitboard_t mirrorColumns(bitboard_t b)
+{
+	bitboard_t r = 0;
+
+	for (; b; b &= b - 1) { r |= SQUAREBIT(SQUARE(BOARDSIZE + 1 - SQUAREX(firstSquare(b)), SQUAREY(firstSquare(b)))); }
+	return r;
+}
+
+static bitboard_t swapXY(bitboard_t b)
+{
+	bitboard_t r = 0;
+
+	for (; b; b &= b - 1) { r |= SQUAREBIT(SQUARE(SQUAREY(firstSquare(b)), SQUAREX(firstSquare(b)))); }
+	return r;
+}
+
+#endif
+
+// Apply one of the 8 symmetries to a bitboard.
+bitboard_t transformBitboard(bitboard_t b, int t)
+{
+	if (t & TRANSFORM_SWAPXY) { b = swapXY(b); }
+	if (t & TRANSFORM_MIRROR) { b = mirrorColumns(b); }
+	if (t & TRANSFORM_FLIP)   { b = flipRows(b); }
+	return b;
+}
+
+// Undo a symmetry by applying its parts in the reverse order (each part undoes itself).
+bitboard_t untransformBitboard(bitboard_t b, int t)
+{
+	if (t & TRANSFORM_FLIP)   { b = flipRows(b); }
+	if (t & TRANSFORM_MIRROR) { b = mirrorColumns(b); }
+	if (t & TRANSFORM_SWAPXY) { b = swapXY(b); }
+	return b;
+}
+
+// Square a square is moved to by a symmetry.
+int transformSquare(int sq, int t)
+{
+	if (sq == PASS) { return PASS; }
+	return firstSquare(transformBitboard(SQUAREBIT(sq), t));
+}
+
+// Square a square came from before a symmetry.
+int untransformSquare(int sq, int t)
+{
+	if (sq == PASS) { return PASS; }
+	return firstSquare(untransformBitboard(SQUAREBIT(sq), t));
+}
+
+// Try all 8 symmetries and keep the one with the lowest own pieces (then the lowest opponent pieces), so that all 8 versions
+// of a position give the same canonical position. Tables keyed on the canonical position share one entry between them.
+int canonicalPosition(const position_t* pos, position_t* canon)
+{
+	int best = 0;
+
+	canon->own = pos->own;
+	canon->opp = pos->opp;
+	for (int t = 1; t < 8; t++)
+	{
+		bitboard_t own = transformBitboard(pos->own, t);
+
+		if (own > canon->own) { continue; }
+
+		bitboard_t opp = transformBitboard(pos->opp, t);
+
+		if ((own < canon->own) || (opp < canon->opp))
+		{
+			canon->own = own;
+			canon->opp = opp;
+			best = t;
+		}
+	}
+
+	if (best == 0)
+	{
+		canon->key = pos->key;
+		canon->swapKey = pos->swapKey;
+	}
+	else
+	{
+		setKeys(canon);
+	}
+	return best;
+}
+
+// Go through each empty square looking for a line of opponent pieces in any direction ending with one of the player's own pieces.
+// This is the original square by square search. It is kept to check and compare against getMoves.
+bitboard_t getMovesRayWalk(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t moves = 0;
+	bitboard_t empty = ~(own | opp);
+
+	for (int sq = 0; sq < NSQUARES; sq++)
+	{
+		// Only an empty square can be a valid move.
+		if ((empty & SQUAREBIT(sq)) == 0) { continue; }
+
+		// Check each of the 8 directions to see if the position is next to an opponent piece.
+		for (int d = 0; d < 8; d++)
+		{
+			int x = SQUAREX(sq) + dirX[d];
+			int y = SQUAREY(sq) + dirY[d];
+			int n = 0;	// Number of opponent pieces passed over.
+
+			// Step over the opponent pieces in this direction.
+			while ((x >= 1) && (x <= BOARDSIZE) && (y >= 1) && (y <= BOARDSIZE) && (opp & SQUAREBIT(SQUARE(x, y))))
+			{
+				x = x + dirX[d];
+				y = y + dirY[d];
+				n++;
+			}
+			// If the line of opponent pieces ends with a player piece it is a valid move.
+			if ((n > 0) && (x >= 1) && (x <= BOARDSIZE) && (y >= 1) && (y <= BOARDSIZE) && (own & SQUAREBIT(SQUARE(x, y))))
+			{
+				moves |= SQUAREBIT(sq);
+				break;
+			}
+		}
+	}
+	return moves;
+}
+
+// Get the flips using the generated function for the square of the move.
+bitboard_t getFlipsScalar(int sq, bitboard_t own, bitboard_t opp)
+{
+	return flipKernel[sq](own, opp);
+}
+
+// Search in all directions from the square of the move, collecting lines of opponent pieces that end with a player piece.
+// This is the original square by square search. It is kept to check and compare against getFlips.
+bitboard_t getFlipsRayWalk(int sq, bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+
+	for (int d = 0; d < 8; d++)
+	{
+		bitboard_t line = 0;	// Opponent pieces found in this direction.
+		int x = SQUAREX(sq) + dirX[d];
+		int y = SQUAREY(sq) + dirY[d];
+
+		while ((x >= 1) && (x <= BOARDSIZE) && (y >= 1) && (y <= BOARDSIZE) && (opp & SQUAREBIT(SQUARE(x, y))))
+		{
+			line |= SQUAREBIT(SQUARE(x, y));
+			x = x + dirX[d];
+			y = y + dirY[d];
+		}
+		// Only capture the line if it is closed off by one of the player's own pieces.
+		if ((x >= 1) && (x <= BOARDSIZE) && (y >= 1) && (y <= BOARDSIZE) && (own & SQUAREBIT(SQUARE(x, y))))
+		{
+			flips |= line;
+		}
+	}
+	return flips;
+}
+
+// Play the move, flip the captured pieces and hand the turn to the opponent.
+// The keys are updated for the new piece and each flipped piece, then swapped over for the change of player.
+bitboard_t playMove(position_t* pos, int sq)
+{
+	bitboard_t flips = getFlips(sq, pos->own, pos->opp);
+	bitboard_t own = pos->own | flips | SQUAREBIT(sq);
+	uint64_t key = pos->key ^ zobristOwn[sq];
+	uint64_t swapKey = pos->swapKey ^ zobristOpp[sq];
+
+	for (bitboard_t b = flips; b; b &= b - 1)
+	{
+		uint64_t flip = zobristOwn[firstSquare(b)] ^ zobristOpp[firstSquare(b)];	// Same change for both keys.
+
+		key ^= flip;
+		swapKey ^= flip;
+	}
+
+	pos->own = pos->opp & ~flips;	// The opponent is now the player to move.
+	pos->opp = own;
+	pos->key = swapKey;
+	pos->swapKey = key;
+	return flips;
+}
+
+// Swap over the players without a move.
+void passMove(position_t* pos)
+{
+	bitboard_t own = pos->own;
+	uint64_t key = pos->key;
+
+	pos->own = pos->opp;
+	pos->opp = own;
+	pos->key = pos->swapKey;
+	pos->swapKey = key;
+}
+
+// Start an empty move stack from a position.
+void startStack(moveStack_t* stack, const position_t* pos)
+{
+	stack->pos = *pos;
+	stack->ply = 0;
+}
+
+// Make the move and push the record of it onto the stack.
+void makeMove(moveStack_t* stack, int sq)
+{
+	undo_t* u = &stack->undo[stack->ply++];
+
+	u->sq = sq;
+	u->key = stack->pos.key;
+	u->swapKey = stack->pos.swapKey;
+	if (sq == PASS)
+	{
+		u->flips = 0;
+		passMove(&stack->pos);
+	}
+	else
+	{
+		u->flips = playMove(&stack->pos, sq);
+	}
+}
+
+// Take back the last move, putting back the flipped pieces and emptying the square of the move. The keys are put back from the record.
+void unmakeMove(moveStack_t* stack)
+{
+	undo_t* u = &stack->undo[--stack->ply];
+	bitboard_t own = stack->pos.opp;	// The player who made the move.
+
+	if (u->sq != PASS)
+	{
+		own = own & ~(u->flips | SQUAREBIT(u->sq));
+		stack->pos.own = stack->pos.own | u->flips;
+	}
+	stack->pos.opp = stack->pos.own;
+	stack->pos.own = own;
+	stack->pos.key = u->key;
+	stack->pos.swapKey = u->swapKey;
+}
@@ -0,0 +1,194 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Bitboard header.
+//*
+//* The board is held as two bit masks, one bit per square, rather than as a table of characters.
+//* Bit 0 is the top left square (x 1, y 1) and the squares go along each row in turn, so for the 8x8 board
+//* bit 7 is top right (x 8, y 1) and bit 63 is bottom right (x 8, y 8).
+//*
+//* The board size is fixed when the engine is compiled, 8 unless BOARDSIZE is defined as 6 or 10 (-DBOARDSIZE=6).
+//* All the sizes and masks below are constants, so each size gets its own code with nothing checked at run time,
+//* and the 8x8 build is the same as if the size were written in. The smaller and larger boards are for quicker tests
+//* and solver experiments on the PC. 10x10 needs 128-bit integers (gcc or clang on a 64-bit PC).
+//*
+//************************************************************************************************************************
+#pragma once
+
+#include <stdint.h>					// For 64-bit integer types.
+#include <stdbool.h>				// To use booleans.
+
+#ifndef BOARDSIZE
+#define BOARDSIZE 8					// Number of columns and rows on the board.
+#endif
+
+#if (BOARDSIZE != 6) && (BOARDSIZE != 8) && (BOARDSIZE != 10)
+#error "BOARDSIZE must be 6, 8 or 10"
+#endif
+
+#define NSQUARES (BOARDSIZE * BOARDSIZE)	// Number of squares on the board.
+
+#if BOARDSIZE <= 8
+typedef uint64_t bitboard_t;		// One bit for each square of the board.
+#define BITBOARDBITS 64
+#elif defined(__SIZEOF_INT128__)
+typedef unsigned __int128 bitboard_t;
+#define BITBOARDBITS 128
+#define BITBOARD(hi, lo) ((((bitboard_t)(hi)) << 64) | (bitboard_t)(lo))	// Write a 128-bit constant as two 64-bit halves.
+#else
+#error "A 10x10 board needs a compiler with 128-bit integers"
+#endif
+
+// Squares that are on the board, for clearing bits shifted off the end of a board smaller than the bitboard.
+#define BOARDMASK ((NSQUARES == BITBOARDBITS) ? ~(bitboard_t)0 : ((((bitboard_t)1) << (NSQUARES % BITBOARDBITS)) - 1))
+#define COLUMN1   (BOARDMASK / ((((bitboard_t)1) << BOARDSIZE) - 1))	// Squares in the left column (one bit in every row).
+#define COLUMNN   (COLUMN1 << (BOARDSIZE - 1))							// Squares in the right column.
+
+// Position on the board, held from the point of view of the player to move.
+// For the 8x8 board this is only 32 bytes, so it can be copied and passed around cheaply.
+// The Zobrist key identifies the position for hash tables. As the pieces are held from the point of view of the player to move,
+// the key also covers the side to move. The key with the sides swapped over is kept as well, so that after a move or a pass
+// the new key is ready without going back over the board.
+typedef struct position position_t;
+
+struct position
+{
+	bitboard_t own;		// Pieces of the player to move.
+	bitboard_t opp;		// Pieces of the opponent.
+	uint64_t key;		// Zobrist key of the position.
+	uint64_t swapKey;	// Zobrist key of the position with the sides swapped over (the key after a pass).
+};
+
+// Record of a move made on a move stack, so that it can be taken back.
+typedef struct undo undo_t;
+
+struct undo
+{
+	int sq;				// Square of the move, or PASS.
+	bitboard_t flips;	// Opponent pieces flipped by the move.
+	uint64_t key;		// Keys of the position before the move.
+	uint64_t swapKey;
+};
+
+#define MAXPLY (2 * NSQUARES)	// Most moves that can be held on a move stack (each move of a game, plus passes).
+#define PASS   NSQUARES			// Square number used for a move where the player misses a turn.
+
+// Position with a stack of the moves made to reach it, so moves can be made and taken back during a search
+// without copying whole boards.
+typedef struct moveStack moveStack_t;
+
+struct moveStack
+{
+	position_t pos;			// Current position.
+	int ply;				// Number of moves on the stack.
+	undo_t undo[MAXPLY];	// Moves made, oldest first.
+};
+
+#define SQUARE(x, y)	((((y) - 1) * BOARDSIZE) + ((x) - 1))	// Square number from column x and row y, both 1 to BOARDSIZE.
+#define SQUAREX(sq)		(((sq) % BOARDSIZE) + 1)				// Column 1 to BOARDSIZE of a square number.
+#define SQUAREY(sq)		(((sq) / BOARDSIZE) + 1)				// Row 1 to BOARDSIZE of a square number.
+#define SQUAREBIT(sq)	(((bitboard_t)1) << (sq))				// Bitboard with only that square set.
+
+// Count the number of squares set in a bitboard.
+static inline int bitCount(bitboard_t b)
+{
+#if defined(__GNUC__) && (BITBOARDBITS == 128)
+	return __builtin_popcountll((uint64_t)b) + __builtin_popcountll((uint64_t)(b >> 64));
+#elif defined(__GNUC__)
+	return __builtin_popcountll(b);
+#else
+	int n = 0;
+	while (b) { b &= b - 1; n++; }	// Clear the lowest set bit until none are left.
+	return n;
+#endif
+}
+
+// Get the square number of the lowest set bit. The bitboard must not be empty.
+static inline int firstSquare(bitboard_t b)
+{
+#if defined(__GNUC__) && (BITBOARDBITS == 128)
+	return ((uint64_t)b != 0) ? __builtin_ctzll((uint64_t)b) : 64 + __builtin_ctzll((uint64_t)(b >> 64));
+#elif defined(__GNUC__)
+	return __builtin_ctzll(b);
+#else
+	int sq = 0;
+	while ((b & 1) == 0) { b >>= 1; sq++; }
+	return sq;
+#endif
+}
+
+// Get the square number of the highest set bit. The bitboard must not be empty.
+static inline int lastSquare(bitboard_t b)
+{
+#if defined(__GNUC__) && (BITBOARDBITS == 128)
+	return ((uint64_t)(b >> 64) != 0) ? 127 - __builtin_clzll((uint64_t)(b >> 64)) : 63 - __builtin_clzll((uint64_t)b);
+#elif defined(__GNUC__)
+	return 63 - __builtin_clzll(b);
+#else
+	int sq = BITBOARDBITS - 1;
+	while ((b & SQUAREBIT(BITBOARDBITS - 1)) == 0) { b <<= 1; sq--; }
+	return sq;
+#endif
+}
+
+void clearPosition(position_t* pos);						// Set up the four starting pieces, with the player to move holding x 4 y 4 and x 5 y 5 on the 8x8 board.
+
+void setKeys(position_t* pos);								// Work out the Zobrist keys of a position from its pieces. Only needed for a position set up by hand.
+
+bitboard_t getMoves(bitboard_t own, bitboard_t opp);		// Get all the valid moves for the player with the own pieces.
+
+bitboard_t getMovesRayWalk(bitboard_t own, bitboard_t opp);	// Square by square version of getMoves, used for checking and benchmarks.
+
+bitboard_t getFlips(int sq, bitboard_t own, bitboard_t opp);	// Get the opponent pieces flipped by the player with the own pieces moving to square sq.
+
+bitboard_t getFlipsRayWalk(int sq, bitboard_t own, bitboard_t opp);	// Square by square version of getFlips, used for checking and benchmarks.
+
+// Evaluation terms, worked out from the bitboards with a few shifts and a bit count rather than by going over the board.
+bitboard_t getNeighbours(bitboard_t b);						// Get the squares next to any of the squares in b.
+int getMobility(bitboard_t own, bitboard_t opp);			// Number of valid moves for the player with the own pieces.
+int getPotentialMobility(bitboard_t own, bitboard_t opp);	// Number of empty squares next to an opponent piece.
+int getFrontier(bitboard_t own, bitboard_t opp);			// Number of own pieces next to an empty square.
+
+bitboard_t playMove(position_t* pos, int sq);				// Play the move for the player to move, returns the flipped pieces. The opponent is then to move.
+
+void passMove(position_t* pos);								// The player to move misses a turn, so the opponent is to move.
+
+void startStack(moveStack_t* stack, const position_t* pos);	// Start an empty move stack from a position.
+
+void makeMove(moveStack_t* stack, int sq);					// Make a move (or PASS) on the stack, recording the flips so the move can be taken back.
+
+void unmakeMove(moveStack_t* stack);						// Take back the last move made on the stack.
+
+// Symmetries of the board. A transform is a number 0-7 made up of these three parts, which are applied in the order
+// swap x and y first, then mirror left to right, then flip top to bottom. Transform 0 leaves the board as it is.
+#define TRANSFORM_SWAPXY 4	// Swap columns and rows (reflect about the diagonal from top left to bottom right).
+#define TRANSFORM_MIRROR 1	// Mirror left to right.
+#define TRANSFORM_FLIP   2	// Flip top to bottom.
+
+bitboard_t transformBitboard(bitboard_t b, int t);			// Apply one of the 8 symmetries to a bitboard.
+bitboard_t untransformBitboard(bitboard_t b, int t);		// Undo a symmetry, so untransformBitboard(transformBitboard(b, t), t) is b.
+int transformSquare(int sq, int t);							// Square a square is moved to by a symmetry (PASS stays PASS).
+int untransformSquare(int sq, int t);						// Square a square came from, for mapping a move back to the original position.
+
+int canonicalPosition(const position_t* pos, position_t* canon);	// Get the version of the position with the lowest pieces out of all 8 symmetries,
+																	// with its keys, and return the transform that gives it.
+
+// Batch versions for working through many separate positions at once (self-play, labelling training data, analysis).
+// The positions are passed as separate arrays of own and opponent pieces (structure of arrays), with n entries in each array.
+// With AVX2 four positions are worked on in each pass of the loop, one in each lane.
+void getMovesBatch(int n, const bitboard_t* own, const bitboard_t* opp, bitboard_t* moves);				// Valid moves for each position.
+void getFlipsBatch(int n, const int* sq, const bitboard_t* own, const bitboard_t* opp, bitboard_t* flips);	// Flips for a move at sq[i] in each position, 0 for PASS.
+
+// getMoves, getFlips and the batch functions select between these versions, using AVX2 on PCs that support it.
+bitboard_t getMovesScalar(bitboard_t own, bitboard_t opp);
+bitboard_t getFlipsScalar(int sq, bitboard_t own, bitboard_t opp);
+void getMovesBatchScalar(int n, const bitboard_t* own, const bitboard_t* opp, bitboard_t* moves);
+void getFlipsBatchScalar(int n, const int* sq, const bitboard_t* own, const bitboard_t* opp, bitboard_t* flips);
+
+bool hasAVX2(void);											// Check whether the processor supports AVX2, always false for the Wii U and for board sizes other than 8x8.
+bitboard_t getMovesAVX2(bitboard_t own, bitboard_t opp);
+bitboard_t getFlipsAVX2(int sq, bitboard_t own, bitboard_t opp);
+void getMovesBatchAVX2(int n, const bitboard_t* own, const bitboard_t* opp, bitboard_t* moves);
+void getFlipsBatchAVX2(int n, const int* sq, const bitboard_t* own, const bitboard_t* opp, bitboard_t* flips);
@@ -0,0 +1,237 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* BitboardAVX2
+//*
+//* AVX2 versions of the move generation and flip functions, for the PC (x86) build of the engine only.
+//* Each 256-bit register holds four copies of the board, one for each of the shifts 1, 8, 9 and 7, so the
+//* four directions towards higher square numbers are worked out together, then the four towards lower numbers.
+//* These are only called when the processor supports AVX2 (see hasAVX2), otherwise the scalar versions are used.
+//* They are written for the 8x8 board only.
+//*
+//************************************************************************************************************************
+#include "Bitboard.h"		// Bitboard types and functions.
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (BOARDSIZE == 8)
+
+#include <immintrin.h>		// For the AVX2 intrinsics.
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>			// For __cpuidex.
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))	// Allow AVX2 in these functions without it being needed for the whole build.
+#endif
+
+// Check whether the processor (and operating system) support AVX2.
+bool hasAVX2(void)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+	int info[4];
+
+	__cpuidex(info, 0, 0);
+	if (info[0] < 7) { return false; }
+	__cpuidex(info, 1, 0);
+	if ((info[2] & (1 << 27)) == 0) { return false; }	// Operating system must save the AVX registers (OSXSAVE).
+	if ((_xgetbv(0) & 6) != 6) { return false; }
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+// OR the four lanes together into one bitboard.
+TARGET_AVX2 static inline bitboard_t orLanes(__m256i v)
+{
+	__m128i h = _mm_or_si128(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+
+	return (bitboard_t)_mm_cvtsi128_si64(_mm_or_si128(h, _mm_unpackhi_epi64(h, h)));
+}
+
+// Find all the valid moves. The same parallel prefix fills as getMovesScalar, four directions at a time.
+TARGET_AVX2 bitboard_t getMovesAVX2(bitboard_t own, bitboard_t opp)
+{
+	const __m256i shift1 = _mm256_set_epi64x(7, 9, 8, 1);
+	const __m256i shift2 = _mm256_set_epi64x(14, 18, 16, 2);
+	const __m256i shift4 = _mm256_set_epi64x(28, 36, 32, 4);
+	const __m256i mask = _mm256_set_epi64x(0x7e7e7e7e7e7e7e7eLL, 0x7e7e7e7e7e7e7e7eLL, -1LL, 0x7e7e7e7e7e7e7e7eLL);
+
+	__m256i p = _mm256_set1_epi64x((long long)own);
+	__m256i o = _mm256_and_si256(_mm256_set1_epi64x((long long)opp), mask);
+	__m256i gu, gd, ou, od;
+
+	// Towards higher square numbers.
+	gu = _mm256_or_si256(p, _mm256_and_si256(o, _mm256_sllv_epi64(p, shift1)));
+	ou = _mm256_and_si256(o, _mm256_sllv_epi64(o, shift1));
+	gu = _mm256_or_si256(gu, _mm256_and_si256(ou, _mm256_sllv_epi64(gu, shift2)));
+	ou = _mm256_and_si256(ou, _mm256_sllv_epi64(ou, shift2));
+	gu = _mm256_or_si256(gu, _mm256_and_si256(ou, _mm256_sllv_epi64(gu, shift4)));
+	gu = _mm256_sllv_epi64(_mm256_xor_si256(gu, p), shift1);
+
+	// Towards lower square numbers.
+	gd = _mm256_or_si256(p, _mm256_and_si256(o, _mm256_srlv_epi64(p, shift1)));
+	od = _mm256_and_si256(o, _mm256_srlv_epi64(o, shift1));
+	gd = _mm256_or_si256(gd, _mm256_and_si256(od, _mm256_srlv_epi64(gd, shift2)));
+	od = _mm256_and_si256(od, _mm256_srlv_epi64(od, shift2));
+	gd = _mm256_or_si256(gd, _mm256_and_si256(od, _mm256_srlv_epi64(gd, shift4)));
+	gd = _mm256_srlv_epi64(_mm256_xor_si256(gd, p), shift1);
+
+	return orLanes(_mm256_or_si256(gu, gd)) & ~(own | opp);
+}
+
+// Get the flips for a move. From the square of the move, step over the opponent pieces in each direction (up to 6),
+// then keep the line only if the next square along holds a player piece.
+TARGET_AVX2 bitboard_t getFlipsAVX2(int sq, bitboard_t own, bitboard_t opp)
+{
+	const __m256i shift = _mm256_set_epi64x(7, 9, 8, 1);
+	const __m256i mask = _mm256_set_epi64x(0x7e7e7e7e7e7e7e7eLL, 0x7e7e7e7e7e7e7e7eLL, -1LL, 0x7e7e7e7e7e7e7e7eLL);
+	const __m256i zero = _mm256_setzero_si256();
+
+	__m256i p = _mm256_set1_epi64x((long long)own);
+	__m256i o = _mm256_and_si256(_mm256_set1_epi64x((long long)opp), mask);
+	__m256i m = _mm256_set1_epi64x((long long)SQUAREBIT(sq));
+	__m256i fu, fd;
+
+	// Towards higher square numbers.
+	fu = _mm256_and_si256(o, _mm256_sllv_epi64(m, shift));
+	fu = _mm256_or_si256(fu, _mm256_and_si256(o, _mm256_sllv_epi64(fu, shift)));
+	fu = _mm256_or_si256(fu, _mm256_and_si256(o, _mm256_sllv_epi64(fu, shift)));
+	fu = _mm256_or_si256(fu, _mm256_and_si256(o, _mm256_sllv_epi64(fu, shift)));
+	fu = _mm256_or_si256(fu, _mm256_and_si256(o, _mm256_sllv_epi64(fu, shift)));
+	fu = _mm256_or_si256(fu, _mm256_and_si256(o, _mm256_sllv_epi64(fu, shift)));
+	fu = _mm256_andnot_si256(_mm256_cmpeq_epi64(_mm256_and_si256(p, _mm256_sllv_epi64(fu, shift)), zero), fu);
+
+	// Towards lower square numbers.
+	fd = _mm256_and_si256(o, _mm256_srlv_epi64(m, shift));
+	fd = _mm256_or_si256(fd, _mm256_and_si256(o, _mm256_srlv_epi64(fd, shift)));
+	fd = _mm256_or_si256(fd, _mm256_and_si256(o, _mm256_srlv_epi64(fd, shift)));
+	fd = _mm256_or_si256(fd, _mm256_and_si256(o, _mm256_srlv_epi64(fd, shift)));
+	fd = _mm256_or_si256(fd, _mm256_and_si256(o, _mm256_srlv_epi64(fd, shift)));
+	fd = _mm256_or_si256(fd, _mm256_and_si256(o, _mm256_srlv_epi64(fd, shift)));
+	fd = _mm256_andnot_si256(_mm256_cmpeq_epi64(_mm256_and_si256(p, _mm256_srlv_epi64(fd, shift)), zero), fd);
+
+	return orLanes(_mm256_or_si256(fu, fd));
+}
+
+// Fill from the pieces in p over the pieces in o towards higher square numbers, s squares at a time, in each lane.
+// This is fillUp from Bitboard.c, with a separate position in each lane rather than a separate direction.
+TARGET_AVX2 static inline __m256i fillUp4(__m256i p, __m256i o, int s)
+{
+	p = _mm256_or_si256(p, _mm256_and_si256(o, _mm256_slli_epi64(p, s)));
+	o = _mm256_and_si256(o, _mm256_slli_epi64(o, s));
+	p = _mm256_or_si256(p, _mm256_and_si256(o, _mm256_slli_epi64(p, 2 * s)));
+	o = _mm256_and_si256(o, _mm256_slli_epi64(o, 2 * s));
+	return _mm256_or_si256(p, _mm256_and_si256(o, _mm256_slli_epi64(p, 4 * s)));
+}
+
+// Fill towards lower square numbers in each lane.
+TARGET_AVX2 static inline __m256i fillDown4(__m256i p, __m256i o, int s)
+{
+	p = _mm256_or_si256(p, _mm256_and_si256(o, _mm256_srli_epi64(p, s)));
+	o = _mm256_and_si256(o, _mm256_srli_epi64(o, s));
+	p = _mm256_or_si256(p, _mm256_and_si256(o, _mm256_srli_epi64(p, 2 * s)));
+	o = _mm256_and_si256(o, _mm256_srli_epi64(o, 2 * s));
+	return _mm256_or_si256(p, _mm256_and_si256(o, _mm256_srli_epi64(p, 4 * s)));
+}
+
+// Valid moves for a batch of positions, four at a time. Each lane works through all 8 directions for its own position,
+// the same as getMovesScalar. Any positions left over at the end are done one at a time.
+TARGET_AVX2 void getMovesBatchAVX2(int n, const bitboard_t* own, const bitboard_t* opp, bitboard_t* moves)
+{
+	const __m256i inner = _mm256_set1_epi64x(0x7e7e7e7e7e7e7e7eLL);
+	int i;
+
+	for (i = 0; i + 4 <= n; i += 4)
+	{
+		__m256i p = _mm256_loadu_si256((const __m256i*)&own[i]);
+		__m256i o = _mm256_loadu_si256((const __m256i*)&opp[i]);
+		__m256i oi = _mm256_and_si256(o, inner);
+		__m256i m;
+
+		m = _mm256_slli_epi64(_mm256_xor_si256(fillUp4(p, oi, 1), p), 1);
+		m = _mm256_or_si256(m, _mm256_srli_epi64(_mm256_xor_si256(fillDown4(p, oi, 1), p), 1));
+		m = _mm256_or_si256(m, _mm256_slli_epi64(_mm256_xor_si256(fillUp4(p, o, 8), p), 8));
+		m = _mm256_or_si256(m, _mm256_srli_epi64(_mm256_xor_si256(fillDown4(p, o, 8), p), 8));
+		m = _mm256_or_si256(m, _mm256_slli_epi64(_mm256_xor_si256(fillUp4(p, oi, 9), p), 9));
+		m = _mm256_or_si256(m, _mm256_srli_epi64(_mm256_xor_si256(fillDown4(p, oi, 9), p), 9));
+		m = _mm256_or_si256(m, _mm256_slli_epi64(_mm256_xor_si256(fillUp4(p, oi, 7), p), 7));
+		m = _mm256_or_si256(m, _mm256_srli_epi64(_mm256_xor_si256(fillDown4(p, oi, 7), p), 7));
+
+		_mm256_storeu_si256((__m256i*)&moves[i], _mm256_andnot_si256(_mm256_or_si256(p, o), m));
+	}
+	for (; i < n; i++) { moves[i] = getMovesScalar(own[i], opp[i]); }
+}
+
+// Flips for a move in each lane. The fill from the move square over the opponent pieces gives the line in each direction,
+// which is only kept if the square after the end of the line holds a player piece.
+#define FLIPSUP4(o, s)   g = _mm256_xor_si256(fillUp4(m, o, s), m); \
+	e = _mm256_andnot_si256(g, _mm256_slli_epi64(_mm256_or_si256(g, m), s)); \
+	f = _mm256_or_si256(f, _mm256_andnot_si256(_mm256_cmpeq_epi64(_mm256_and_si256(e, p), zero), g))
+#define FLIPSDOWN4(o, s) g = _mm256_xor_si256(fillDown4(m, o, s), m); \
+	e = _mm256_andnot_si256(g, _mm256_srli_epi64(_mm256_or_si256(g, m), s)); \
+	f = _mm256_or_si256(f, _mm256_andnot_si256(_mm256_cmpeq_epi64(_mm256_and_si256(e, p), zero), g))
+
+// Flips for a batch of moves, four positions at a time. A PASS (square 64) shifts the move bit out, so gives no flips.
+TARGET_AVX2 void getFlipsBatchAVX2(int n, const int* sq, const bitboard_t* own, const bitboard_t* opp, bitboard_t* flips)
+{
+	const __m256i inner = _mm256_set1_epi64x(0x7e7e7e7e7e7e7e7eLL);
+	const __m256i one = _mm256_set1_epi64x(1);
+	const __m256i zero = _mm256_setzero_si256();
+	int i;
+
+	for (i = 0; i + 4 <= n; i += 4)
+	{
+		__m256i p = _mm256_loadu_si256((const __m256i*)&own[i]);
+		__m256i o = _mm256_loadu_si256((const __m256i*)&opp[i]);
+		__m256i oi = _mm256_and_si256(o, inner);
+		__m256i m = _mm256_sllv_epi64(one, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&sq[i])));
+		__m256i f = zero;
+		__m256i g, e;
+
+		FLIPSUP4(oi, 1);
+		FLIPSDOWN4(oi, 1);
+		FLIPSUP4(o, 8);
+		FLIPSDOWN4(o, 8);
+		FLIPSUP4(oi, 9);
+		FLIPSDOWN4(oi, 9);
+		FLIPSUP4(oi, 7);
+		FLIPSDOWN4(oi, 7);
+
+		_mm256_storeu_si256((__m256i*)&flips[i], f);
+	}
+	for (; i < n; i++) { flips[i] = (sq[i] == PASS) ? 0 : getFlipsScalar(sq[i], own[i], opp[i]); }
+}
+
+#else
+
+// Not an x86 build (such as the Wii U), or a board size that does not fit the lanes, so the scalar versions are always used.
+bool hasAVX2(void)
+{
+	return false;
+}
+
+bitboard_t getMovesAVX2(bitboard_t own, bitboard_t opp)
+{
+	return getMovesScalar(own, opp);
+}
+
+bitboard_t getFlipsAVX2(int sq, bitboard_t own, bitboard_t opp)
+{
+	return getFlipsScalar(sq, own, opp);
+}
+
+void getMovesBatchAVX2(int n, const bitboard_t* own, const bitboard_t* opp, bitboard_t* moves)
+{
+	getMovesBatchScalar(n, own, opp, moves);
+}
+
+void getFlipsBatchAVX2(int n, const int* sq, const bitboard_t* own, const bitboard_t* opp, bitboard_t* flips)
+{
+	getFlipsBatchScalar(n, sq, own, opp, flips);
+}
+
+#endif
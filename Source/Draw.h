@@ -3,13 +3,19 @@
 
 #include <stdbool.h>	// To use bools
 
+#include "Bitboard.h"	// For the board size.
+
 // The background colour is defined. Pixels in images that match the background colour are not processed, in effect giving sprites a transparent background.
 #define BKGNDCLR 0x80808000l
 
 #define BLKSIZE 80						// Size of sprites.
 
-#define XDISPMAX (8 * BLKSIZE)			// Limits to game screen size to 8x8 board for Othello.
-#define YDISPMAX (8 * BLKSIZE)
+#define XDISPMAX (BOARDSIZE * BLKSIZE)	// Limits to game screen size to the board for Othello.
+#define YDISPMAX (BOARDSIZE * BLKSIZE)
+
+#if BOARDSIZE > 8
+#error "The sprites only fit on the TV screen for boards up to 8x8"
+#endif
 
 #define XOFFSET  (1240 - XDISPMAX) / 2	// Offset to position game screen centrally on TV.
 #define YOFFSET  ( 720 - YDISPMAX) / 2
@@ -0,0 +1,796 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Endgame
+//*
+//* Exact endgame solver. Every line of moves is played out to the end of the game (with alpha-beta cutting off the lines
+//* that cannot change the result), so the score is the real final score with best play by both players. Scores inside
+//* the solver are in discs, and are only multiplied up to search scores at the root and in the hash table.
+//*
+//* The solver works in three parts, as the work near the leaves is most of the time taken:
+//*   Far from the end, positions are kept in the hash table and the moves are ordered by the hash move, then the fewest
+//*   replies for the opponent (fastest first), then parity. Furthest from the end the evaluation is used instead of the
+//*   number of replies, as a bad move order costs most there.
+//*   Nearer the end, the hash table costs more than it saves, so the position is just the two bitboards.
+//*   For the last four empty squares there are separate functions for each number of squares, which try each empty square
+//*   in turn without generating the moves, and the last move only counts the pieces it would flip.
+//*
+//* Parity: the board is split into quadrants, and moving in a quadrant with an odd number of empty squares tends to
+//* leave the player with the last move there, which is an advantage. Those moves are tried first.
+//*
+//* With more than one thread the solve is shared out by Young Brothers Wait. Once the first move of a position has been
+//* solved (and has not cut off), the other moves are put up as a split point that any idle thread can take moves from,
+//* while the thread that made it works through them as well. Each thread keeps its split points in its own queue, and
+//* idle threads take from the oldest, nearest the root, where there is most work. A move that cuts off at a split point
+//* stops the threads still working on it, and on any split points below it. The moves at the root are solved one at a
+//* time, so the result is the same with any number of threads.
+//*
+//************************************************************************************************************************
+#include "Endgame.h"		// Endgame solver API.
+#include "Stable.h"			// Stable pieces, for the stability cutoff.
+#include "Thread.h"			// Helper threads for the parallel solve.
+
+#include <stdlib.h>			// For malloc and free.
+
+#define INFDISCS (NSQUARES + 1)	// Higher than any final score in discs.
+#define HASHEMPTIES  10			// Positions with more empty squares than this are kept in the hash table.
+#define FASTESTEMPTIES 7		// Positions with at least this many empty squares have their moves ordered fastest first.
+#define EVALEMPTIES  12			// Positions with at least this many empty squares have their moves ordered by the evaluation.
+#define PARITYORDER  8			// Ordering bonus for a move in a quadrant with an odd number of empty squares.
+#define MOBILITYORDER -16		// Ordering penalty for each move the opponent has after the move.
+#define TIMECHECK    63			// The time is checked each time this many more positions have been searched with the hash table.
+#define SPLITEMPTIES 12			// Positions with at least this many empty squares can be shared between threads.
+#define MAXSPLITS    NSQUARES	// Most split points a thread can have open at once, one for each empty square.
+
+// Quadrants of the board.
+#define HALF      (BOARDSIZE / 2)
+#define LEFTHALF  (COLUMN1 * ((((bitboard_t)1) << HALF) - 1))		// Columns 1 to HALF.
+#define TOPHALF   ((((bitboard_t)1) << (HALF * BOARDSIZE)) - 1)		// Rows 1 to HALF.
+
+static const bitboard_t quadrants[4] =
+{
+	LEFTHALF & TOPHALF, BOARDMASK & ~LEFTHALF & TOPHALF, BOARDMASK & LEFTHALF & ~TOPHALF, BOARDMASK & ~LEFTHALF & ~TOPHALF
+};
+
+// A position whose moves are shared between threads. It lives on the stack of the thread that made it, which waits for
+// the other threads to finish with it before going on.
+typedef struct splitPoint splitPoint_t;
+
+struct splitPoint
+{
+	position_t pos;				// Position the moves are made from.
+	int moves[NSQUARES];		// Moves to share out, in the order to solve them.
+	int n;
+	int next;					// Next move to be taken, shared.
+	int alpha;					// Window, alpha goes up as better moves are found (shared).
+	int beta;
+	int best;					// Best score and move so far, changed with the lock held.
+	int bestMove;
+	bool cutoff;				// Set when a move reaches beta, to stop the threads working on the others.
+	int helpers;				// Number of other threads working on the moves, shared.
+	int lock;
+	splitPoint_t* parent;		// Split point the thread that made this one was working on, so its cutoff stops this too.
+};
+
+// Split points a thread has open, oldest first.
+typedef struct splitQueue splitQueue_t;
+
+struct splitQueue
+{
+	splitPoint_t* splits[MAXSPLITS];
+	int count;					// Shared, changed with the lock held.
+	int lock;
+};
+
+// Data shared by all of the threads of a solve.
+typedef struct workers workers_t;
+
+struct workers
+{
+	int threads;				// Number of threads, including the calling thread.
+	int idle;					// Number of threads looking for work, shared.
+	bool done;					// Set when the solve is finished, to end the helper threads.
+	bool stop;					// Set when the time runs out, to stop all of the threads.
+	splitQueue_t queues[MAXTHREADS];
+};
+
+// Working data for a solve, one for each thread.
+typedef struct solver solver_t;
+
+struct solver
+{
+	moveStack_t stack;			// Position being solved, while it is far enough from the end to use the hash table.
+	hashTable_t* hash;			// Solved positions, and best moves from earlier searches.
+	unsigned long long nodes;	// Number of positions searched.
+	unsigned long long cutoffs;			// Number of positions where the search was cut off.
+	unsigned long long firstCutoffs;	// Number of those where the first move searched was enough to cut off.
+	unsigned long long hashNodes;		// Number of positions searched with the hash table, to know when to check the time.
+	long long stopTime;			// Time to stop in milliseconds, or 0 for no time limit.
+	bool stopped;				// Set when the time runs out, the scores from then on are not used.
+	const evalWeights_t* eval;	// Weightings for the evaluation, used for the move ordering.
+	int id;						// Thread number, 0 for the calling thread.
+	workers_t* workers;			// Shared data, or NULL with only one thread.
+	splitPoint_t* current;		// Split point being worked on, or NULL.
+};
+
+// Final score in discs, when neither player can move. Empty squares are not given to either player, the same as the search.
+static inline int discDifference(bitboard_t own, bitboard_t opp)
+{
+	return bitCount(own) - bitCount(opp);
+}
+
+// Get the empty squares that are in a quadrant with an odd number of empty squares.
+static bitboard_t oddSquares(bitboard_t empty)
+{
+	bitboard_t odd = 0;
+
+	for (int a = 0; a < 4; a++)
+	{
+		if (bitCount(empty & quadrants[a]) & 1) { odd |= empty & quadrants[a]; }
+	}
+	return odd;
+}
+
+// Last empty square. The final score is worked out from the number of pieces the move would flip, without making it.
+static int solveLast1(solver_t* s, bitboard_t own, bitboard_t opp, int sq1)
+{
+	int score = discDifference(own, opp);
+	int flips;
+
+	s->nodes++;
+	if ((flips = bitCount(getFlips(sq1, own, opp))) != 0) { return score + 1 + (2 * flips); }
+	if ((flips = bitCount(getFlips(sq1, opp, own))) != 0) { return score - 1 - (2 * flips); }
+	return score;	// Neither player can move.
+}
+
+// Last two empty squares.
+static int solveLast2(solver_t* s, bitboard_t own, bitboard_t opp, int alpha, int beta, int sq1, int sq2, bool passed)
+{
+	int best = -INFDISCS;
+	int score;
+	bitboard_t flips;
+
+	s->nodes++;
+	if ((flips = getFlips(sq1, own, opp)) != 0)
+	{
+		best = -solveLast1(s, opp & ~flips, own | flips | SQUAREBIT(sq1), sq2);
+		if (best >= beta) { return best; }
+	}
+	if ((flips = getFlips(sq2, own, opp)) != 0)
+	{
+		score = -solveLast1(s, opp & ~flips, own | flips | SQUAREBIT(sq2), sq1);
+		if (score > best) { best = score; }
+	}
+
+	if (best == -INFDISCS)
+	{
+		if (passed) { return discDifference(own, opp); }
+		return -solveLast2(s, opp, own, -beta, -alpha, sq1, sq2, true);
+	}
+	return best;
+}
+
+// Last three empty squares.
+static int solveLast3(solver_t* s, bitboard_t own, bitboard_t opp, int alpha, int beta, int sq1, int sq2, int sq3, bool passed)
+{
+	int best = -INFDISCS;
+	int score;
+	bitboard_t flips;
+
+	s->nodes++;
+	if ((flips = getFlips(sq1, own, opp)) != 0)
+	{
+		best = -solveLast2(s, opp & ~flips, own | flips | SQUAREBIT(sq1), -beta, -alpha, sq2, sq3, false);
+		if (best >= beta) { return best; }
+		if (best > alpha) { alpha = best; }
+	}
+	if ((flips = getFlips(sq2, own, opp)) != 0)
+	{
+		score = -solveLast2(s, opp & ~flips, own | flips | SQUAREBIT(sq2), -beta, -alpha, sq1, sq3, false);
+		if (score >= beta) { return score; }
+		if (score > best) { best = score; if (score > alpha) { alpha = score; } }
+	}
+	if ((flips = getFlips(sq3, own, opp)) != 0)
+	{
+		score = -solveLast2(s, opp & ~flips, own | flips | SQUAREBIT(sq3), -beta, -alpha, sq1, sq2, false);
+		if (score > best) { best = score; }
+	}
+
+	if (best == -INFDISCS)
+	{
+		if (passed) { return discDifference(own, opp); }
+		return -solveLast3(s, opp, own, -beta, -alpha, sq1, sq2, sq3, true);
+	}
+	return best;
+}
+
+// Last four empty squares.
+static int solveLast4(solver_t* s, bitboard_t own, bitboard_t opp, int alpha, int beta, int sq1, int sq2, int sq3, int sq4, bool passed)
+{
+	int best = -INFDISCS;
+	int score;
+	bitboard_t flips;
+
+	s->nodes++;
+	if ((flips = getFlips(sq1, own, opp)) != 0)
+	{
+		best = -solveLast3(s, opp & ~flips, own | flips | SQUAREBIT(sq1), -beta, -alpha, sq2, sq3, sq4, false);
+		if (best >= beta) { return best; }
+		if (best > alpha) { alpha = best; }
+	}
+	if ((flips = getFlips(sq2, own, opp)) != 0)
+	{
+		score = -solveLast3(s, opp & ~flips, own | flips | SQUAREBIT(sq2), -beta, -alpha, sq1, sq3, sq4, false);
+		if (score >= beta) { return score; }
+		if (score > best) { best = score; if (score > alpha) { alpha = score; } }
+	}
+	if ((flips = getFlips(sq3, own, opp)) != 0)
+	{
+		score = -solveLast3(s, opp & ~flips, own | flips | SQUAREBIT(sq3), -beta, -alpha, sq1, sq2, sq4, false);
+		if (score >= beta) { return score; }
+		if (score > best) { best = score; if (score > alpha) { alpha = score; } }
+	}
+	if ((flips = getFlips(sq4, own, opp)) != 0)
+	{
+		score = -solveLast3(s, opp & ~flips, own | flips | SQUAREBIT(sq4), -beta, -alpha, sq1, sq2, sq3, false);
+		if (score > best) { best = score; }
+	}
+
+	if (best == -INFDISCS)
+	{
+		if (passed) { return discDifference(own, opp); }
+		return -solveLast4(s, opp, own, -beta, -alpha, sq1, sq2, sq3, sq4, true);
+	}
+	return best;
+}
+
+// Solve a position with four or fewer empty squares. The squares are passed in parity order, odd quadrants first.
+static int solveSmall(solver_t* s, bitboard_t own, bitboard_t opp, int alpha, int beta, int empties)
+{
+	bitboard_t empty = BOARDMASK & ~(own | opp);
+	bitboard_t odd = oddSquares(empty);
+	int sq[4] = { PASS, PASS, PASS, PASS };
+	int n = 0;
+
+	for (bitboard_t b = odd; b; b &= b - 1) { sq[n++] = firstSquare(b); }
+	for (bitboard_t b = empty & ~odd; b; b &= b - 1) { sq[n++] = firstSquare(b); }
+
+	switch (empties)
+	{
+	case 4:  return solveLast4(s, own, opp, alpha, beta, sq[0], sq[1], sq[2], sq[3], false);
+	case 3:  return solveLast3(s, own, opp, alpha, beta, sq[0], sq[1], sq[2], false);
+	case 2:  return solveLast2(s, own, opp, alpha, beta, sq[0], sq[1], false);
+	case 1:  return solveLast1(s, own, opp, sq[0]);
+	default: s->nodes++; return discDifference(own, opp);
+	}
+}
+
+// Solve a position near the end, without the hash table. Moves are ordered fastest first while there are enough empty
+// squares for it to pay, and by parity after that.
+static int solveNoHash(solver_t* s, bitboard_t own, bitboard_t opp, int alpha, int beta, int empties, bool passed)
+{
+	bitboard_t moves = getMoves(own, opp);
+	int best = -INFDISCS;
+
+	s->nodes++;
+	if (moves == 0)
+	{
+		if (passed) { return discDifference(own, opp); }
+		return -solveNoHash(s, opp, own, -beta, -alpha, empties, true);
+	}
+
+	int list[NSQUARES];			// Moves, in the order they are searched.
+	bitboard_t flips[NSQUARES];	// Pieces flipped by each move.
+	int order[NSQUARES];		// Ordering score of each move.
+	bitboard_t odd = oddSquares(BOARDMASK & ~(own | opp));
+	int n = 0;
+
+	// Put the moves in order as they are found, highest ordering score first.
+	for (; moves; moves &= moves - 1)
+	{
+		int sq = firstSquare(moves);
+		bitboard_t f = getFlips(sq, own, opp);
+		int score = (SQUAREBIT(sq) & odd) ? PARITYORDER : 0;
+		int a = n;
+
+		if (empties >= FASTESTEMPTIES) { score += MOBILITYORDER * getMobility(opp & ~f, own | f | SQUAREBIT(sq)); }
+		for (; (a > 0) && (score > order[a - 1]); a--)
+		{
+			list[a] = list[a - 1];
+			flips[a] = flips[a - 1];
+			order[a] = order[a - 1];
+		}
+		list[a] = sq;
+		flips[a] = f;
+		order[a] = score;
+		n++;
+	}
+
+	for (int a = 0; a < n; a++)
+	{
+		bitboard_t newOwn = opp & ~flips[a];
+		bitboard_t newOpp = own | flips[a] | SQUAREBIT(list[a]);
+		int score;
+
+		if (empties - 1 <= 4) { score = -solveSmall(s, newOwn, newOpp, -beta, -alpha, empties - 1); }
+		else { score = -solveNoHash(s, newOwn, newOpp, -beta, -alpha, empties - 1, false); }
+
+		if (score > best)
+		{
+			best = score;
+			if (score > alpha) { alpha = score; }
+			if (alpha >= beta)
+			{
+				s->cutoffs++;
+				if (a == 0) { s->firstCutoffs++; }
+				break;
+			}
+		}
+	}
+	return best;
+}
+
+// Check whether the scores being worked out are no longer needed, because the time has run out or a split point being
+// worked on (or one above it) has been cut off.
+static bool aborted(solver_t* s)
+{
+	if (s->stopped) { return true; }
+	if (s->workers == NULL) { return false; }
+	if (readFlag(&s->workers->stop))
+	{
+		s->stopped = true;
+		return true;
+	}
+	for (splitPoint_t* sp = s->current; sp != NULL; sp = sp->parent)
+	{
+		if (readFlag(&sp->cutoff)) { return true; }
+	}
+	return false;
+}
+
+static int solveHash(solver_t* s, int alpha, int beta);
+
+// Solve moves of a split point until there are none left or it is cut off. The top of the stack is the split point's
+// position. Each move is solved in the same way as in solveHash, with the window as it is when the move is taken.
+static void solveSplit(solver_t* s, splitPoint_t* sp)
+{
+	for (;;)
+	{
+		int a = addShared(&sp->next, 1);
+
+		if ((a >= sp->n) || aborted(s)) { break; }
+
+		int alpha = readShared(&sp->alpha);
+		int score;
+
+		makeMove(&s->stack, sp->moves[a]);
+		prefetchHash(s->hash, s->stack.pos.key);
+		score = -solveHash(s, -alpha - 1, -alpha);
+		if ((score > alpha) && (score < sp->beta)) { score = -solveHash(s, -sp->beta, -alpha); }
+		unmakeMove(&s->stack);
+		if (aborted(s)) { break; }
+
+		lockSpin(&sp->lock);
+		if (score > sp->best)
+		{
+			sp->best = score;
+			sp->bestMove = sp->moves[a];
+			if (score > sp->alpha) { writeShared(&sp->alpha, score); }
+			if (score >= sp->beta) { setFlag(&sp->cutoff); }
+		}
+		unlockSpin(&sp->lock);
+	}
+}
+
+// Find a split point of any thread with moves left, and help solve them. A thread waiting for the helpers of its own
+// split point only helps with split points below it, so that it is free again as soon as they finish. Returns false if
+// there was nothing to help with.
+// The moves are made on the thread's own stack, on top of the moves already there, so only the position has to be put
+// back afterwards (the stack is not copied, as the threads' stacks are small on the Wii U). A split point is only taken
+// if there is room on the move stack to play it out to the end, with a pass before each move at most.
+static bool helpSplit(solver_t* s, splitPoint_t* below)
+{
+	workers_t* w = s->workers;
+	splitPoint_t* sp = NULL;
+
+	for (int t = 1; (t <= w->threads) && (sp == NULL); t++)
+	{
+		splitQueue_t* q = &w->queues[(s->id + t) % w->threads];
+
+		if (readShared(&q->count) == 0) { continue; }
+		lockSpin(&q->lock);
+		for (int a = 0; (a < q->count) && (sp == NULL); a++)
+		{
+			splitPoint_t* p = q->splits[a];
+			bool under = (below == NULL);
+
+			for (splitPoint_t* up = p; (up != NULL) && !under; up = up->parent) { under = (up == below); }
+			if (under && (readShared(&p->next) < p->n) && !readFlag(&p->cutoff) &&
+				(s->stack.ply + (2 * (NSQUARES - bitCount(p->pos.own | p->pos.opp))) <= MAXPLY))
+			{
+				sp = p;
+				addShared(&sp->helpers, 1);	// While the queue is locked, so the split point cannot finish first.
+			}
+		}
+		unlockSpin(&q->lock);
+	}
+	if (sp == NULL) { return false; }
+
+	position_t pos = s->stack.pos;
+	splitPoint_t* current = s->current;
+
+	if (below == NULL) { addShared(&w->idle, -1); }
+	s->stack.pos = sp->pos;
+	s->current = sp;
+	solveSplit(s, sp);
+	s->stack.pos = pos;
+	s->current = current;
+	if (below == NULL) { addShared(&w->idle, 1); }
+	addShared(&sp->helpers, -1);		// The split point may be gone after this.
+	return true;
+}
+
+// Share the moves left at the position on the top of the stack with any idle threads, and solve them. Returns the best
+// score, with the best move in bestMove if one of the moves beats best.
+static int splitMoves(solver_t* s, const int* moves, int n, int alpha, int beta, int best, int* bestMove)
+{
+	splitQueue_t* q = &s->workers->queues[s->id];
+	splitPoint_t sp;
+
+	sp.pos = s->stack.pos;
+	for (int a = 0; a < n; a++) { sp.moves[a] = moves[a]; }
+	sp.n = n;
+	sp.next = 0;
+	sp.alpha = alpha;
+	sp.beta = beta;
+	sp.best = best;
+	sp.bestMove = *bestMove;
+	sp.cutoff = false;
+	sp.helpers = 0;
+	sp.lock = 0;
+	sp.parent = s->current;
+
+	lockSpin(&q->lock);
+	q->splits[q->count] = &sp;
+	writeShared(&q->count, q->count + 1);
+	unlockSpin(&q->lock);
+
+	s->current = &sp;
+	solveSplit(s, &sp);
+
+	// Take the split point off the queue, so no more threads join it, then wait for the ones working on it.
+	lockSpin(&q->lock);
+	writeShared(&q->count, q->count - 1);
+	unlockSpin(&q->lock);
+	while (readShared(&sp.helpers) > 0)
+	{
+		if (!helpSplit(s, &sp)) { yieldThread(); }
+	}
+	s->current = sp.parent;
+
+	if (sp.best >= beta) { s->cutoffs++; }
+	*bestMove = sp.bestMove;
+	return sp.best;
+}
+
+// Solve the position on the top of the stack, with the hash table. Only the first move gets the full window, the others
+// are searched with a null window first (principal variation search), as they are expected to be worse.
+static int solveHash(solver_t* s, int alpha, int beta)
+{
+	position_t* pos = &s->stack.pos;
+	int empties = NSQUARES - bitCount(pos->own | pos->opp);
+
+	if (empties <= HASHEMPTIES) { return solveNoHash(s, pos->own, pos->opp, alpha, beta, empties, false); }
+
+	bitboard_t moves = getMoves(pos->own, pos->opp);
+	int best = -INFDISCS;
+	int score;
+
+	s->nodes++;
+	s->hashNodes++;
+	if (((s->hashNodes & TIMECHECK) == 0) && (s->stopTime != 0) && (getMillis() >= s->stopTime))
+	{
+		s->stopped = true;
+		if (s->workers != NULL) { setFlag(&s->workers->stop); }
+	}
+	if (aborted(s)) { return 0; }
+
+	if (moves == 0)
+	{
+		if (getMoves(pos->opp, pos->own) == 0) { return discDifference(pos->own, pos->opp); }
+		makeMove(&s->stack, PASS);
+		score = -solveHash(s, -beta, -alpha);
+		unmakeMove(&s->stack);
+		return score;
+	}
+
+	// A solved position only needs its score. A position from the search only gives the move to try first.
+	hashEntry_t e;
+	int hashMove = PASS;
+	int oldAlpha = alpha;
+	int bestMove = PASS;
+
+	if (probeHash(s->hash, pos->key, &e))
+	{
+		hashMove = e.move;
+		if (e.depth == SOLVEDEPTH)
+		{
+			score = e.score / DISCSCORE;
+			if (e.bound == BOUND_EXACT) { return score; }
+			if ((e.bound == BOUND_LOWER) && (score >= beta)) { return score; }
+			if ((e.bound == BOUND_UPPER) && (score <= alpha)) { return score; }
+		}
+	}
+
+	// Stability cutoff, as in the search. The opponent's stable pieces limit the best final score.
+	if ((alpha >= NSQUARES - (2 * bitCount(pos->opp))) && (alpha >= (2 * empties) - 2))
+	{
+		int maxScore = NSQUARES - (2 * bitCount(getStable(pos->opp, pos->own)));
+
+		if (maxScore <= alpha) { return maxScore; }
+	}
+
+	int list[NSQUARES];		// Moves, in the order they are searched.
+	int order[NSQUARES];	// Ordering score of each move.
+	bitboard_t odd = oddSquares(BOARDMASK & ~(pos->own | pos->opp));
+	int n = 0;
+
+	for (; moves; moves &= moves - 1)
+	{
+		int sq = firstSquare(moves);
+		int order1;
+		int a = n;
+
+		// Far from the end the evaluation after the move is a better guide than just the number of replies.
+		if (empties >= EVALEMPTIES)
+		{
+			position_t next = *pos;
+
+			playMove(&next, sq);
+			order1 = -evaluate(&next, s->eval);
+		}
+		else
+		{
+			bitboard_t f = getFlips(sq, pos->own, pos->opp);
+
+			order1 = MOBILITYORDER * getMobility(pos->opp & ~f, pos->own | f | SQUAREBIT(sq));
+		}
+
+		if (sq == hashMove) { order1 = INFDISCS * 1024; }	// Higher than any other ordering score.
+		if (SQUAREBIT(sq) & odd) { order1 += PARITYORDER; }
+		for (; (a > 0) && (order1 > order[a - 1]); a--)
+		{
+			list[a] = list[a - 1];
+			order[a] = order[a - 1];
+		}
+		list[a] = sq;
+		order[a] = order1;
+		n++;
+	}
+
+	for (int a = 0; a < n; a++)
+	{
+		// Once the first move is solved, the others can be shared with any idle threads.
+		if ((a == 1) && (empties >= SPLITEMPTIES) && (s->workers != NULL) && (readShared(&s->workers->idle) > 0) &&
+			(s->workers->queues[s->id].count < MAXSPLITS))
+		{
+			best = splitMoves(s, list + 1, n - 1, alpha, beta, best, &bestMove);
+			break;
+		}
+
+		makeMove(&s->stack, list[a]);
+		prefetchHash(s->hash, s->stack.pos.key);
+		if (a == 0) { score = -solveHash(s, -beta, -alpha); }
+		else
+		{
+			score = -solveHash(s, -alpha - 1, -alpha);
+			if ((score > alpha) && (score < beta)) { score = -solveHash(s, -beta, -alpha); }
+		}
+		unmakeMove(&s->stack);
+		if (aborted(s)) { return 0; }
+
+		if (score > best)
+		{
+			best = score;
+			bestMove = list[a];
+			if (score > alpha) { alpha = score; }
+			if (alpha >= beta)
+			{
+				s->cutoffs++;
+				if (a == 0) { s->firstCutoffs++; }
+				break;
+			}
+		}
+	}
+
+	if (!aborted(s))
+	{
+		int bound = (best <= oldAlpha) ? BOUND_UPPER : ((best >= beta) ? BOUND_LOWER : BOUND_EXACT);
+
+		storeHash(s->hash, pos->key, SOLVEDEPTH, best * DISCSCORE, bound, bestMove);
+	}
+	return best;
+}
+
+// Solve each of the moves at the start within the window alpha to beta, in the same way as the search. The best move is
+// moved to the front of the list, keeping the first of equal moves. Returns the best score, which is only a bound if it
+// is outside the window.
+static int solveRoot(solver_t* s, int* moves, int n, int alpha, int beta)
+{
+	int best = -INFDISCS;
+	int bestN = 0;
+
+	for (int a = 0; a < n; a++)
+	{
+		int score;
+
+		makeMove(&s->stack, moves[a]);
+		if (a == 0) { score = -solveHash(s, -beta, -alpha); }
+		else
+		{
+			score = -solveHash(s, -alpha - 1, -alpha);
+			if ((score > alpha) && (score < beta)) { score = -solveHash(s, -beta, -alpha); }
+		}
+		unmakeMove(&s->stack);
+
+		if (aborted(s)) { return best; }
+		if (score > best)
+		{
+			best = score;
+			if (score > alpha)
+			{
+				alpha = score;
+				bestN = a;
+			}
+			if (alpha >= beta) { break; }
+		}
+	}
+
+	int move = moves[bestN];
+	for (int a = bestN; a > 0; a--) { moves[a] = moves[a - 1]; }
+	moves[0] = move;
+	return best;
+}
+
+// Start the working data for a thread.
+static void startSolver(solver_t* s, int id, const position_t* pos, long long stopTime, const evalWeights_t* eval, hashTable_t* hash, workers_t* workers)
+{
+	startStack(&s->stack, pos);
+	s->hash = hash;
+	s->nodes = 0;
+	s->cutoffs = 0;
+	s->firstCutoffs = 0;
+	s->hashNodes = 0;
+	s->stopTime = stopTime;
+	s->stopped = false;
+	s->eval = eval;
+	s->id = id;
+	s->workers = workers;
+	s->current = NULL;
+}
+
+// A helper thread for the parallel solve.
+typedef struct helper helper_t;
+
+struct helper
+{
+	solver_t s;					// Working data for the thread.
+	thread_t thread;
+};
+
+// Run a helper thread. It helps with any split point it can find until the solve is finished.
+static void helperSolve(void* arg)
+{
+	solver_t* s = &((helper_t*)arg)->s;
+	workers_t* w = s->workers;
+
+	addShared(&w->idle, 1);
+	while (!readFlag(&w->done))
+	{
+		if (!helpSplit(s, NULL)) { yieldThread(); }
+	}
+	addShared(&w->idle, -1);
+}
+
+// Solve the position. A win/loss/draw solve only needs the window -1 to 1, as any win cuts off as well as any other.
+// With MTD(f) the exact score is found by null window solves, starting from a guess from the evaluation, with the hash
+// table keeping the work from one to the next.
+bool solveEndgame(const position_t* pos, int* moves, int n, int mode, bool mtdf, int threads, long long stopTime, const evalWeights_t* eval, hashTable_t* hash, searchResult_t* result)
+{
+	solver_t s;
+	workers_t* workers = NULL;
+	helper_t* helpers = NULL;
+	int helperN = 0;
+	int score;
+
+	initStable();
+
+	// Start the helper threads, which wait for split points to help with.
+	if (threads > MAXTHREADS) { threads = MAXTHREADS; }
+	if (threads > 1)
+	{
+		workers = (workers_t*)malloc(sizeof(workers_t));
+		helpers = (helper_t*)malloc(sizeof(helper_t) * (threads - 1));
+		if ((workers == NULL) || (helpers == NULL))
+		{
+			free(workers);
+			workers = NULL;
+		}
+	}
+	if (workers != NULL)
+	{
+		workers->threads = threads;
+		workers->idle = 0;
+		workers->done = false;
+		workers->stop = false;
+		for (int a = 0; a < threads; a++)
+		{
+			workers->queues[a].count = 0;
+			workers->queues[a].lock = 0;
+		}
+		for (int a = 0; a < threads - 1; a++)
+		{
+			helper_t* h = &helpers[helperN];
+
+			startSolver(&h->s, helperN + 1, pos, stopTime, eval, hash, workers);
+			if (startThread(&h->thread, helperN + 1, helperSolve, h)) { helperN++; }
+		}
+		if (helperN == 0)
+		{
+			free(workers);
+			workers = NULL;
+		}
+	}
+	startSolver(&s, 0, pos, stopTime, eval, hash, workers);
+
+	if (mode == MODE_WLD)
+	{
+		score = solveRoot(&s, moves, n, -1, 1);
+		score = (score > 0) - (score < 0);	// Only the sign is known.
+	}
+	else if (mtdf)
+	{
+		int lower = -INFDISCS;
+		int upper = INFDISCS;
+
+		score = evaluate(pos, eval) / DISCSCORE;
+		while (lower < upper)
+		{
+			int beta = (score == lower) ? score + 1 : score;
+
+			score = solveRoot(&s, moves, n, beta - 1, beta);
+			if (aborted(&s)) { break; }
+			if (score < beta) { upper = score; }
+			else { lower = score; }
+		}
+	}
+	else { score = solveRoot(&s, moves, n, -INFDISCS, INFDISCS); }
+
+	// End the helpers, and count their work with the calling thread's.
+	bool stopped = aborted(&s);
+
+	if (workers != NULL)
+	{
+		setFlag(&workers->done);
+		for (int a = 0; a < helperN; a++)
+		{
+			joinThread(&helpers[a].thread);
+			s.nodes += helpers[a].s.nodes;
+			s.cutoffs += helpers[a].s.cutoffs;
+			s.firstCutoffs += helpers[a].s.firstCutoffs;
+		}
+		free(workers);
+	}
+	free(helpers);
+
+	result->move = (n > 0) ? moves[0] : PASS;
+	result->score = score * DISCSCORE;
+	result->depth = NSQUARES - bitCount(pos->own | pos->opp);
+	result->mode = mode;
+	result->nodes = s.nodes;
+	result->cutoffs = s.cutoffs;
+	result->firstCutoffs = s.firstCutoffs;
+	return !stopped;
+}
@@ -0,0 +1,26 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Endgame header.
+//*
+//* Exact endgame solver. Near the end of the game every line of moves can be played out to the end, so the computer can
+//* find the move with the best final score rather than relying on the evaluation. Proving only a win, loss or draw is
+//* much quicker, so that can be done a few moves earlier.
+//*
+//************************************************************************************************************************
+#pragma once
+
+#include "Search.h"					// Search types and scores.
+
+#define SOLVEDEPTH 255				// Depth stored in the hash table for solved positions, deeper than any search so the
+									// search can use them too.
+
+bool solveEndgame(const position_t* pos, int* moves, int n, int mode, bool mtdf, int threads, long long stopTime, const evalWeights_t* eval, hashTable_t* hash, searchResult_t* result);
+									// Find the best of the n moves by playing out every line to the end of the game, for the exact
+									// score (mode MODE_EXACT) or only whether it is a win, loss or draw (MODE_WLD). The best move is
+									// put first, moves with the same score are taken in the order given. The exact score can be
+									// found with MTD(f). The solve is shared between the number of threads given (1 for none).
+									// The evaluation weightings (eval) are only used to order the moves.
+									// Returns false if the stop time (0 for none) is reached first.
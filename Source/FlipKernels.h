@@ -0,0 +1,2285 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* FlipKernels header.
+//*
+//* GENERATED BY Tools/GenFlip.c, DO NOT EDIT. One flip function per square, selected through flipKernel[square].
+//*
+//* In each direction the nearest square that is not an opponent piece is found (the outflank square).
+//* If that square holds a player piece, the opponent pieces between it and the move are flipped.
+//*
+//************************************************************************************************************************
+#pragma once
+
+#include "Bitboard.h"	// Bitboard types and functions.
+
+// Flips for a move at x 1 y 1.
+static bitboard_t flipX1Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000000000feULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000000000feULL;
+
+	// Down.
+	o = ~opp & 0x0101010101010100ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0101010101010100ULL;
+
+	// Down and right.
+	o = ~opp & 0x8040201008040200ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8040201008040200ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 1.
+static bitboard_t flipX2Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000000000fcULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000000000fcULL;
+
+	// Down.
+	o = ~opp & 0x0202020202020200ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0202020202020200ULL;
+
+	// Down and right.
+	o = ~opp & 0x0080402010080400ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0080402010080400ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 1.
+static bitboard_t flipX3Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000000000f8ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000000000f8ULL;
+
+	// Down.
+	o = ~opp & 0x0404040404040400ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0404040404040400ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000804020100800ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000804020100800ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000000010200ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000010200ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000000003ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000003ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000003ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 1.
+static bitboard_t flipX4Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000000000f0ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000000000f0ULL;
+
+	// Down.
+	o = ~opp & 0x0808080808080800ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0808080808080800ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000008040201000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000008040201000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000001020400ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000001020400ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000000007ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000007ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000007ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 1.
+static bitboard_t flipX5Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000000000e0ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000000000e0ULL;
+
+	// Down.
+	o = ~opp & 0x1010101010101000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x1010101010101000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000080402000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000080402000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000102040800ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000102040800ULL;
+
+	// Left.
+	o = (~opp & 0x000000000000000fULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000000000000fULL;
+	flips |= (0 - (t << 1)) & 0x000000000000000fULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 1.
+static bitboard_t flipX6Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000000000c0ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000000000c0ULL;
+
+	// Down.
+	o = ~opp & 0x2020202020202000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x2020202020202000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000000804000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000804000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000010204081000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000010204081000ULL;
+
+	// Left.
+	o = (~opp & 0x000000000000001fULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000000000001fULL;
+	flips |= (0 - (t << 1)) & 0x000000000000001fULL;
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 1.
+static bitboard_t flipX7Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x4040404040404000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x4040404040404000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0001020408102000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0001020408102000ULL;
+
+	// Left.
+	o = (~opp & 0x000000000000003fULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000000000003fULL;
+	flips |= (0 - (t << 1)) & 0x000000000000003fULL;
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 1.
+static bitboard_t flipX8Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x8080808080808000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8080808080808000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0102040810204000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0102040810204000ULL;
+
+	// Left.
+	o = (~opp & 0x000000000000007fULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000000000007fULL;
+	flips |= (0 - (t << 1)) & 0x000000000000007fULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 2.
+static bitboard_t flipX1Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000000000fe00ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000000000fe00ULL;
+
+	// Down.
+	o = ~opp & 0x0101010101010000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0101010101010000ULL;
+
+	// Down and right.
+	o = ~opp & 0x4020100804020000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x4020100804020000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 2.
+static bitboard_t flipX2Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000000000fc00ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000000000fc00ULL;
+
+	// Down.
+	o = ~opp & 0x0202020202020000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0202020202020000ULL;
+
+	// Down and right.
+	o = ~opp & 0x8040201008040000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8040201008040000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 2.
+static bitboard_t flipX3Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000000000f800ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000000000f800ULL;
+
+	// Down.
+	o = ~opp & 0x0404040404040000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0404040404040000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0080402010080000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0080402010080000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000001020000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000001020000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000000300ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000300ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000300ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 2.
+static bitboard_t flipX4Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000000000f000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000000000f000ULL;
+
+	// Down.
+	o = ~opp & 0x0808080808080000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0808080808080000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000804020100000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000804020100000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000102040000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000102040000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000000700ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000700ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000700ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 2.
+static bitboard_t flipX5Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000000000e000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000000000e000ULL;
+
+	// Down.
+	o = ~opp & 0x1010101010100000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x1010101010100000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000008040200000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000008040200000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000010204080000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000010204080000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000000f00ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000f00ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000f00ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 2.
+static bitboard_t flipX6Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000000000c000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000000000c000ULL;
+
+	// Down.
+	o = ~opp & 0x2020202020200000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x2020202020200000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000080400000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000080400000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0001020408100000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0001020408100000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000001f00ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000001f00ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000001f00ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 2.
+static bitboard_t flipX7Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x4040404040400000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x4040404040400000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0102040810200000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0102040810200000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000003f00ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000003f00ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000003f00ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 2.
+static bitboard_t flipX8Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x8080808080800000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8080808080800000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0204081020400000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0204081020400000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000007f00ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000007f00ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000007f00ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 3.
+static bitboard_t flipX1Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000fe0000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000fe0000ULL;
+
+	// Down.
+	o = ~opp & 0x0101010101000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0101010101000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x2010080402000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x2010080402000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000000101ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000101ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000101ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000000204ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000204ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000204ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 3.
+static bitboard_t flipX2Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000fc0000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000fc0000ULL;
+
+	// Down.
+	o = ~opp & 0x0202020202000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0202020202000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x4020100804000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x4020100804000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000000202ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000202ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000202ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000000408ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000408ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000408ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 3.
+static bitboard_t flipX3Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000f80000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000f80000ULL;
+
+	// Down.
+	o = ~opp & 0x0404040404000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0404040404000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x8040201008000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8040201008000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000102000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000102000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000030000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000030000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000030000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000000404ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000404ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000404ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000000201ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000201ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000201ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000000810ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000810ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000810ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 3.
+static bitboard_t flipX4Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000f00000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000f00000ULL;
+
+	// Down.
+	o = ~opp & 0x0808080808000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0808080808000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0080402010000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0080402010000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000010204000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000010204000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000070000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000070000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000070000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000000808ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000808ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000808ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000000402ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000402ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000402ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000001020ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000001020ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000001020ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 3.
+static bitboard_t flipX5Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000e00000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000e00000ULL;
+
+	// Down.
+	o = ~opp & 0x1010101010000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x1010101010000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000804020000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000804020000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0001020408000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0001020408000000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000000f0000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000000f0000ULL;
+	flips |= (0 - (t << 1)) & 0x00000000000f0000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000001010ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000001010ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000001010ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000000804ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000804ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000804ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000002040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000002040ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000002040ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 3.
+static bitboard_t flipX6Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000c00000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000c00000ULL;
+
+	// Down.
+	o = ~opp & 0x2020202020000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x2020202020000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000008040000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000008040000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0102040810000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0102040810000000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000001f0000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000001f0000ULL;
+	flips |= (0 - (t << 1)) & 0x00000000001f0000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000002020ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000002020ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000002020ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000001008ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000001008ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000001008ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000004080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000004080ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000004080ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 3.
+static bitboard_t flipX7Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x4040404040000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x4040404040000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0204081020000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0204081020000000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000003f0000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000003f0000ULL;
+	flips |= (0 - (t << 1)) & 0x00000000003f0000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000004040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000004040ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000004040ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000002010ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000002010ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000002010ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 3.
+static bitboard_t flipX8Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x8080808080000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8080808080000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0408102040000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0408102040000000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000007f0000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000007f0000ULL;
+	flips |= (0 - (t << 1)) & 0x00000000007f0000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000008080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000008080ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000008080ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000004020ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000004020ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000004020ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 4.
+static bitboard_t flipX1Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000fe000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000fe000000ULL;
+
+	// Down.
+	o = ~opp & 0x0101010100000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0101010100000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x1008040200000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x1008040200000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000010101ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000010101ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000010101ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000020408ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000020408ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000020408ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 4.
+static bitboard_t flipX2Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000fc000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000fc000000ULL;
+
+	// Down.
+	o = ~opp & 0x0202020200000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0202020200000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x2010080400000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x2010080400000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000020202ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000020202ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000020202ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000040810ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000040810ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000040810ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 4.
+static bitboard_t flipX3Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000f8000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000f8000000ULL;
+
+	// Down.
+	o = ~opp & 0x0404040400000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0404040400000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x4020100800000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x4020100800000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000010200000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000010200000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000003000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000003000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000003000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000040404ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000040404ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000040404ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000020100ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000020100ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000020100ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000081020ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000081020ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000081020ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 4.
+static bitboard_t flipX4Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000f0000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000f0000000ULL;
+
+	// Down.
+	o = ~opp & 0x0808080800000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0808080800000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x8040201000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8040201000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0001020400000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0001020400000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000007000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000007000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000007000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000080808ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000080808ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000080808ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000040201ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000040201ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000040201ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000102040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000102040ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000102040ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 4.
+static bitboard_t flipX5Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000e0000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000e0000000ULL;
+
+	// Down.
+	o = ~opp & 0x1010101000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x1010101000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0080402000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0080402000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0102040800000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0102040800000000ULL;
+
+	// Left.
+	o = (~opp & 0x000000000f000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000000f000000ULL;
+	flips |= (0 - (t << 1)) & 0x000000000f000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000101010ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000101010ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000101010ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000080402ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000080402ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000080402ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000204080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000204080ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000204080ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 4.
+static bitboard_t flipX6Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00000000c0000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00000000c0000000ULL;
+
+	// Down.
+	o = ~opp & 0x2020202000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x2020202000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000804000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000804000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0204081000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0204081000000000ULL;
+
+	// Left.
+	o = (~opp & 0x000000001f000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000001f000000ULL;
+	flips |= (0 - (t << 1)) & 0x000000001f000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000202020ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000202020ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000202020ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000100804ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000100804ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000100804ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000408000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000408000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000408000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 4.
+static bitboard_t flipX7Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x4040404000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x4040404000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0408102000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0408102000000000ULL;
+
+	// Left.
+	o = (~opp & 0x000000003f000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000003f000000ULL;
+	flips |= (0 - (t << 1)) & 0x000000003f000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000404040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000404040ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000404040ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000201008ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000201008ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000201008ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 4.
+static bitboard_t flipX8Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x8080808000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8080808000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0810204000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0810204000000000ULL;
+
+	// Left.
+	o = (~opp & 0x000000007f000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000007f000000ULL;
+	flips |= (0 - (t << 1)) & 0x000000007f000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000808080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000808080ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000808080ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000402010ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000402010ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000402010ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 5.
+static bitboard_t flipX1Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000fe00000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000fe00000000ULL;
+
+	// Down.
+	o = ~opp & 0x0101010000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0101010000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0804020000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0804020000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000001010101ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000001010101ULL;
+	flips |= (0 - (t << 1)) & 0x0000000001010101ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000002040810ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000002040810ULL;
+	flips |= (0 - (t << 1)) & 0x0000000002040810ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 5.
+static bitboard_t flipX2Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000fc00000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000fc00000000ULL;
+
+	// Down.
+	o = ~opp & 0x0202020000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0202020000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x1008040000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x1008040000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000002020202ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000002020202ULL;
+	flips |= (0 - (t << 1)) & 0x0000000002020202ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000004081020ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000004081020ULL;
+	flips |= (0 - (t << 1)) & 0x0000000004081020ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 5.
+static bitboard_t flipX3Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000f800000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000f800000000ULL;
+
+	// Down.
+	o = ~opp & 0x0404040000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0404040000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x2010080000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x2010080000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0001020000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0001020000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000300000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000300000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000300000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000004040404ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000004040404ULL;
+	flips |= (0 - (t << 1)) & 0x0000000004040404ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000002010000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000002010000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000002010000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000008102040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000008102040ULL;
+	flips |= (0 - (t << 1)) & 0x0000000008102040ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 5.
+static bitboard_t flipX4Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000f000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000f000000000ULL;
+
+	// Down.
+	o = ~opp & 0x0808080000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0808080000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x4020100000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x4020100000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0102040000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0102040000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000700000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000700000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000700000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000008080808ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000008080808ULL;
+	flips |= (0 - (t << 1)) & 0x0000000008080808ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000004020100ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000004020100ULL;
+	flips |= (0 - (t << 1)) & 0x0000000004020100ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000010204080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000010204080ULL;
+	flips |= (0 - (t << 1)) & 0x0000000010204080ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 5.
+static bitboard_t flipX5Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000e000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000e000000000ULL;
+
+	// Down.
+	o = ~opp & 0x1010100000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x1010100000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x8040200000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8040200000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0204080000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0204080000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000f00000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000f00000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000f00000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000010101010ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000010101010ULL;
+	flips |= (0 - (t << 1)) & 0x0000000010101010ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000008040201ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000008040201ULL;
+	flips |= (0 - (t << 1)) & 0x0000000008040201ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000020408000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000020408000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000020408000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 5.
+static bitboard_t flipX6Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000c000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000c000000000ULL;
+
+	// Down.
+	o = ~opp & 0x2020200000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x2020200000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0080400000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0080400000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0408100000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0408100000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000001f00000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000001f00000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000001f00000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000020202020ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000020202020ULL;
+	flips |= (0 - (t << 1)) & 0x0000000020202020ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000010080402ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000010080402ULL;
+	flips |= (0 - (t << 1)) & 0x0000000010080402ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000040800000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000040800000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000040800000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 5.
+static bitboard_t flipX7Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x4040400000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x4040400000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0810200000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0810200000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000003f00000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000003f00000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000003f00000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000040404040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000040404040ULL;
+	flips |= (0 - (t << 1)) & 0x0000000040404040ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000020100804ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000020100804ULL;
+	flips |= (0 - (t << 1)) & 0x0000000020100804ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 5.
+static bitboard_t flipX8Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x8080800000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8080800000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x1020400000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x1020400000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000007f00000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000007f00000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000007f00000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000080808080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000080808080ULL;
+	flips |= (0 - (t << 1)) & 0x0000000080808080ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000040201008ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000040201008ULL;
+	flips |= (0 - (t << 1)) & 0x0000000040201008ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 6.
+static bitboard_t flipX1Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000fe0000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000fe0000000000ULL;
+
+	// Down.
+	o = ~opp & 0x0101000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0101000000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0402000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0402000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000101010101ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000101010101ULL;
+	flips |= (0 - (t << 1)) & 0x0000000101010101ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000204081020ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000204081020ULL;
+	flips |= (0 - (t << 1)) & 0x0000000204081020ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 6.
+static bitboard_t flipX2Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000fc0000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000fc0000000000ULL;
+
+	// Down.
+	o = ~opp & 0x0202000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0202000000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0804000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0804000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000202020202ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000202020202ULL;
+	flips |= (0 - (t << 1)) & 0x0000000202020202ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000408102040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000408102040ULL;
+	flips |= (0 - (t << 1)) & 0x0000000408102040ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 6.
+static bitboard_t flipX3Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000f80000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000f80000000000ULL;
+
+	// Down.
+	o = ~opp & 0x0404000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0404000000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x1008000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x1008000000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0102000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0102000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000030000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000030000000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000030000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000404040404ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000404040404ULL;
+	flips |= (0 - (t << 1)) & 0x0000000404040404ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000201000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000201000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000201000000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000810204080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000810204080ULL;
+	flips |= (0 - (t << 1)) & 0x0000000810204080ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 6.
+static bitboard_t flipX4Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000f00000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000f00000000000ULL;
+
+	// Down.
+	o = ~opp & 0x0808000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0808000000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x2010000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x2010000000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0204000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0204000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000070000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000070000000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000070000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000808080808ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000808080808ULL;
+	flips |= (0 - (t << 1)) & 0x0000000808080808ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000402010000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000402010000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000402010000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000001020408000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000001020408000ULL;
+	flips |= (0 - (t << 1)) & 0x0000001020408000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 6.
+static bitboard_t flipX5Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000e00000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000e00000000000ULL;
+
+	// Down.
+	o = ~opp & 0x1010000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x1010000000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x4020000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x4020000000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0408000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0408000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x00000f0000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000f0000000000ULL;
+	flips |= (0 - (t << 1)) & 0x00000f0000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000001010101010ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000001010101010ULL;
+	flips |= (0 - (t << 1)) & 0x0000001010101010ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000804020100ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000804020100ULL;
+	flips |= (0 - (t << 1)) & 0x0000000804020100ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000002040800000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000002040800000ULL;
+	flips |= (0 - (t << 1)) & 0x0000002040800000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 6.
+static bitboard_t flipX6Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000c00000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000c00000000000ULL;
+
+	// Down.
+	o = ~opp & 0x2020000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x2020000000000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x8040000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8040000000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0810000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0810000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x00001f0000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00001f0000000000ULL;
+	flips |= (0 - (t << 1)) & 0x00001f0000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000002020202020ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000002020202020ULL;
+	flips |= (0 - (t << 1)) & 0x0000002020202020ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000001008040201ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000001008040201ULL;
+	flips |= (0 - (t << 1)) & 0x0000001008040201ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000004080000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000004080000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000004080000000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 6.
+static bitboard_t flipX7Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x4040000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x4040000000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x1020000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x1020000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x00003f0000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00003f0000000000ULL;
+	flips |= (0 - (t << 1)) & 0x00003f0000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000004040404040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000004040404040ULL;
+	flips |= (0 - (t << 1)) & 0x0000004040404040ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000002010080402ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000002010080402ULL;
+	flips |= (0 - (t << 1)) & 0x0000002010080402ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 6.
+static bitboard_t flipX8Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x8080000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x8080000000000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x2040000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x2040000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x00007f0000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00007f0000000000ULL;
+	flips |= (0 - (t << 1)) & 0x00007f0000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000008080808080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000008080808080ULL;
+	flips |= (0 - (t << 1)) & 0x0000008080808080ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000004020100804ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000004020100804ULL;
+	flips |= (0 - (t << 1)) & 0x0000004020100804ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 7.
+static bitboard_t flipX1Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00fe000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00fe000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000010101010101ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000010101010101ULL;
+	flips |= (0 - (t << 1)) & 0x0000010101010101ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000020408102040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000020408102040ULL;
+	flips |= (0 - (t << 1)) & 0x0000020408102040ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 7.
+static bitboard_t flipX2Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00fc000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00fc000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000020202020202ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000020202020202ULL;
+	flips |= (0 - (t << 1)) & 0x0000020202020202ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000040810204080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000040810204080ULL;
+	flips |= (0 - (t << 1)) & 0x0000040810204080ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 7.
+static bitboard_t flipX3Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00f8000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00f8000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0003000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0003000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x0003000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000040404040404ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000040404040404ULL;
+	flips |= (0 - (t << 1)) & 0x0000040404040404ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000020100000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000020100000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000020100000000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000081020408000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000081020408000ULL;
+	flips |= (0 - (t << 1)) & 0x0000081020408000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 7.
+static bitboard_t flipX4Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00f0000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00f0000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0007000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0007000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x0007000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000080808080808ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000080808080808ULL;
+	flips |= (0 - (t << 1)) & 0x0000080808080808ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000040201000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000040201000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000040201000000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000102040800000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000102040800000ULL;
+	flips |= (0 - (t << 1)) & 0x0000102040800000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 7.
+static bitboard_t flipX5Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00e0000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00e0000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x000f000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000f000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x000f000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000101010101010ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000101010101010ULL;
+	flips |= (0 - (t << 1)) & 0x0000101010101010ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000080402010000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000080402010000ULL;
+	flips |= (0 - (t << 1)) & 0x0000080402010000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000204080000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000204080000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000204080000000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 7.
+static bitboard_t flipX6Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x00c0000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x00c0000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x001f000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x001f000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x001f000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000202020202020ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000202020202020ULL;
+	flips |= (0 - (t << 1)) & 0x0000202020202020ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000100804020100ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000100804020100ULL;
+	flips |= (0 - (t << 1)) & 0x0000100804020100ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000408000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000408000000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000408000000000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 7.
+static bitboard_t flipX7Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & 0x003f000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x003f000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x003f000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000404040404040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000404040404040ULL;
+	flips |= (0 - (t << 1)) & 0x0000404040404040ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000201008040201ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000201008040201ULL;
+	flips |= (0 - (t << 1)) & 0x0000201008040201ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 7.
+static bitboard_t flipX8Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & 0x007f000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x007f000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x007f000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000808080808080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000808080808080ULL;
+	flips |= (0 - (t << 1)) & 0x0000808080808080ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000402010080402ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000402010080402ULL;
+	flips |= (0 - (t << 1)) & 0x0000402010080402ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 8.
+static bitboard_t flipX1Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0xfe00000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0xfe00000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0001010101010101ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0001010101010101ULL;
+	flips |= (0 - (t << 1)) & 0x0001010101010101ULL;
+
+	// Up and right.
+	o = (~opp & 0x0002040810204080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0002040810204080ULL;
+	flips |= (0 - (t << 1)) & 0x0002040810204080ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 8.
+static bitboard_t flipX2Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0xfc00000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0xfc00000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0002020202020202ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0002020202020202ULL;
+	flips |= (0 - (t << 1)) & 0x0002020202020202ULL;
+
+	// Up and right.
+	o = (~opp & 0x0004081020408000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0004081020408000ULL;
+	flips |= (0 - (t << 1)) & 0x0004081020408000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 8.
+static bitboard_t flipX3Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0xf800000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0xf800000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0300000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0300000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x0300000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0004040404040404ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0004040404040404ULL;
+	flips |= (0 - (t << 1)) & 0x0004040404040404ULL;
+
+	// Up and left.
+	o = (~opp & 0x0002010000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0002010000000000ULL;
+	flips |= (0 - (t << 1)) & 0x0002010000000000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0008102040800000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0008102040800000ULL;
+	flips |= (0 - (t << 1)) & 0x0008102040800000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 8.
+static bitboard_t flipX4Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0xf000000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0xf000000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0700000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0700000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x0700000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0008080808080808ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0008080808080808ULL;
+	flips |= (0 - (t << 1)) & 0x0008080808080808ULL;
+
+	// Up and left.
+	o = (~opp & 0x0004020100000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0004020100000000ULL;
+	flips |= (0 - (t << 1)) & 0x0004020100000000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0010204080000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0010204080000000ULL;
+	flips |= (0 - (t << 1)) & 0x0010204080000000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 8.
+static bitboard_t flipX5Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0xe000000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0xe000000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x0f00000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0f00000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x0f00000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0010101010101010ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0010101010101010ULL;
+	flips |= (0 - (t << 1)) & 0x0010101010101010ULL;
+
+	// Up and left.
+	o = (~opp & 0x0008040201000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0008040201000000ULL;
+	flips |= (0 - (t << 1)) & 0x0008040201000000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0020408000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0020408000000000ULL;
+	flips |= (0 - (t << 1)) & 0x0020408000000000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 8.
+static bitboard_t flipX6Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0xc000000000000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0xc000000000000000ULL;
+
+	// Left.
+	o = (~opp & 0x1f00000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x1f00000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x1f00000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0020202020202020ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0020202020202020ULL;
+	flips |= (0 - (t << 1)) & 0x0020202020202020ULL;
+
+	// Up and left.
+	o = (~opp & 0x0010080402010000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0010080402010000ULL;
+	flips |= (0 - (t << 1)) & 0x0010080402010000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0040800000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0040800000000000ULL;
+	flips |= (0 - (t << 1)) & 0x0040800000000000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 8.
+static bitboard_t flipX7Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & 0x3f00000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x3f00000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x3f00000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0040404040404040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0040404040404040ULL;
+	flips |= (0 - (t << 1)) & 0x0040404040404040ULL;
+
+	// Up and left.
+	o = (~opp & 0x0020100804020100ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0020100804020100ULL;
+	flips |= (0 - (t << 1)) & 0x0020100804020100ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 8.
+static bitboard_t flipX8Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & 0x7f00000000000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x7f00000000000000ULL;
+	flips |= (0 - (t << 1)) & 0x7f00000000000000ULL;
+
+	// Up.
+	o = (~opp & 0x0080808080808080ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0080808080808080ULL;
+	flips |= (0 - (t << 1)) & 0x0080808080808080ULL;
+
+	// Up and left.
+	o = (~opp & 0x0040201008040201ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0040201008040201ULL;
+	flips |= (0 - (t << 1)) & 0x0040201008040201ULL;
+
+	return flips;
+}
+
+// Flip function for each square.
+static bitboard_t (* const flipKernel[64])(bitboard_t own, bitboard_t opp) =
+{
+	flipX1Y1, flipX2Y1, flipX3Y1, flipX4Y1, flipX5Y1, flipX6Y1, flipX7Y1, flipX8Y1,
+	flipX1Y2, flipX2Y2, flipX3Y2, flipX4Y2, flipX5Y2, flipX6Y2, flipX7Y2, flipX8Y2,
+	flipX1Y3, flipX2Y3, flipX3Y3, flipX4Y3, flipX5Y3, flipX6Y3, flipX7Y3, flipX8Y3,
+	flipX1Y4, flipX2Y4, flipX3Y4, flipX4Y4, flipX5Y4, flipX6Y4, flipX7Y4, flipX8Y4,
+	flipX1Y5, flipX2Y5, flipX3Y5, flipX4Y5, flipX5Y5, flipX6Y5, flipX7Y5, flipX8Y5,
+	flipX1Y6, flipX2Y6, flipX3Y6, flipX4Y6, flipX5Y6, flipX6Y6, flipX7Y6, flipX8Y6,
+	flipX1Y7, flipX2Y7, flipX3Y7, flipX4Y7, flipX5Y7, flipX6Y7, flipX7Y7, flipX8Y7,
+	flipX1Y8, flipX2Y8, flipX3Y8, flipX4Y8, flipX5Y8, flipX6Y8, flipX7Y8, flipX8Y8
+};
@@ -0,0 +1,3812 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* FlipKernels10 header, for the 10x10 board.
+//*
+//* GENERATED BY Tools/GenFlip.c, DO NOT EDIT. One flip function per square, selected through flipKernel[square].
+//* Only included when BOARDSIZE is 10.
+//*
+//* In each direction the nearest square that is not an opponent piece is found (the outflank square).
+//* If that square holds a player piece, the opponent pieces between it and the move are flipped.
+//*
+//************************************************************************************************************************
+#pragma once
+
+#include "Bitboard.h"	// Bitboard types and functions.
+
+// Flips for a move at x 1 y 1.
+static bitboard_t flipX1Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000003feULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000003feULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000004010040ULL, 0x1004010040100400ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004010040ULL, 0x1004010040100400ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000801002004ULL, 0x0080100200400800ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000801002004ULL, 0x0080100200400800ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 1.
+static bitboard_t flipX2Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000003fcULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000003fcULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000008020080ULL, 0x2008020080200800ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008020080ULL, 0x2008020080200800ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000002004008ULL, 0x0100200400801000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000002004008ULL, 0x0100200400801000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 1.
+static bitboard_t flipX3Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000003f8ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000003f8ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000010040100ULL, 0x4010040100401000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010040100ULL, 0x4010040100401000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000008010ULL, 0x0200400801002000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000008010ULL, 0x0200400801002000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000100800ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000000000100800ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000000003ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000000003ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000000003ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 1.
+static bitboard_t flipX4Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000003f0ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000003f0ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000020080200ULL, 0x8020080200802000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020080200ULL, 0x8020080200802000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000020ULL, 0x0400801002004000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000020ULL, 0x0400801002004000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000000040201000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000000040201000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000000007ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000000007ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000000007ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 1.
+static bitboard_t flipX5Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000003e0ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000003e0ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000040100401ULL, 0x0040100401004000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040100401ULL, 0x0040100401004000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0801002004008000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0801002004008000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000010080402000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000010080402000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x000000000000000fULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x000000000000000fULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x000000000000000fULL);
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 1.
+static bitboard_t flipX6Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000003c0ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000003c0ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000080200802ULL, 0x0080200802008000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080200802ULL, 0x0080200802008000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0002004008010000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0002004008010000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0004020100804000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0004020100804000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x000000000000001fULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x000000000000001fULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x000000000000001fULL);
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 1.
+static bitboard_t flipX7Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000000380ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000000000000380ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000100401004ULL, 0x0100401004010000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100401004ULL, 0x0100401004010000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000008010020000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000008010020000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x1008040201008000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x1008040201008000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x000000000000003fULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x000000000000003fULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x000000000000003fULL);
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 1.
+static bitboard_t flipX8Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000000300ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000000000000300ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000200802008ULL, 0x0200802008020000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200802008ULL, 0x0200802008020000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000000020040000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000000020040000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000040ULL, 0x2010080402010000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000040ULL, 0x2010080402010000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x000000000000007fULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x000000000000007fULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x000000000000007fULL);
+
+	return flips;
+}
+
+// Flips for a move at x 9 y 1.
+static bitboard_t flipX9Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000401004010ULL, 0x0401004010040000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000401004010ULL, 0x0401004010040000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000010080ULL, 0x4020100804020000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000010080ULL, 0x4020100804020000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000000ffULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x00000000000000ffULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x00000000000000ffULL);
+
+	return flips;
+}
+
+// Flips for a move at x 10 y 1.
+static bitboard_t flipX10Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000802008020ULL, 0x0802008020080000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000802008020ULL, 0x0802008020080000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000004020100ULL, 0x8040201008040000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004020100ULL, 0x8040201008040000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000001ffULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x00000000000001ffULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x00000000000001ffULL);
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 2.
+static bitboard_t flipX1Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000ff800ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000ff800ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000004010040ULL, 0x1004010040100000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004010040ULL, 0x1004010040100000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000400801002ULL, 0x0040080100200000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000400801002ULL, 0x0040080100200000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 2.
+static bitboard_t flipX2Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000ff000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000ff000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000008020080ULL, 0x2008020080200000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008020080ULL, 0x2008020080200000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000801002004ULL, 0x0080100200400000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000801002004ULL, 0x0080100200400000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 2.
+static bitboard_t flipX3Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000fe000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000fe000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000010040100ULL, 0x4010040100400000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010040100ULL, 0x4010040100400000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000002004008ULL, 0x0100200400800000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000002004008ULL, 0x0100200400800000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000000040200000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000000040200000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000000c00ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000000c00ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000000c00ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 2.
+static bitboard_t flipX4Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000fc000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000fc000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000020080200ULL, 0x8020080200800000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020080200ULL, 0x8020080200800000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000008010ULL, 0x0200400801000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000008010ULL, 0x0200400801000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000010080400000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000010080400000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000001c00ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000001c00ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000001c00ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 2.
+static bitboard_t flipX5Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000f8000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000f8000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000040100401ULL, 0x0040100401000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040100401ULL, 0x0040100401000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000020ULL, 0x0400801002000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000020ULL, 0x0400801002000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0004020100800000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0004020100800000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000003c00ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000003c00ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000003c00ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 2.
+static bitboard_t flipX6Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000f0000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000f0000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000080200802ULL, 0x0080200802000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080200802ULL, 0x0080200802000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0801002004000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0801002004000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x1008040201000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x1008040201000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000007c00ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000007c00ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000007c00ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 2.
+static bitboard_t flipX7Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000e0000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000e0000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000100401004ULL, 0x0100401004000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100401004ULL, 0x0100401004000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0002004008000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0002004008000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000040ULL, 0x2010080402000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000040ULL, 0x2010080402000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x000000000000fc00ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x000000000000fc00ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x000000000000fc00ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 2.
+static bitboard_t flipX8Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x00000000000c0000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x00000000000c0000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000200802008ULL, 0x0200802008000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200802008ULL, 0x0200802008000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000008010000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000008010000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000010080ULL, 0x4020100804000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000010080ULL, 0x4020100804000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x000000000001fc00ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x000000000001fc00ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x000000000001fc00ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 9 y 2.
+static bitboard_t flipX9Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000401004010ULL, 0x0401004010000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000401004010ULL, 0x0401004010000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000004020100ULL, 0x8040201008000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004020100ULL, 0x8040201008000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x000000000003fc00ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x000000000003fc00ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x000000000003fc00ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 10 y 2.
+static bitboard_t flipX10Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000802008020ULL, 0x0802008020000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000802008020ULL, 0x0802008020000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000008040201ULL, 0x0080402010000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008040201ULL, 0x0080402010000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x000000000007fc00ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x000000000007fc00ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x000000000007fc00ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 3.
+static bitboard_t flipX1Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000003fe00000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000003fe00000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000004010040ULL, 0x1004010040000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004010040ULL, 0x1004010040000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000200400801ULL, 0x0020040080000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200400801ULL, 0x0020040080000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000000401ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000000401ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000000401ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000000804ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000000804ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000000804ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 3.
+static bitboard_t flipX2Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000003fc00000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000003fc00000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000008020080ULL, 0x2008020080000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008020080ULL, 0x2008020080000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000400801002ULL, 0x0040080100000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000400801002ULL, 0x0040080100000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000000802ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000000802ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000000802ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000001008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000001008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000001008ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 3.
+static bitboard_t flipX3Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000003f800000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000003f800000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000010040100ULL, 0x4010040100000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010040100ULL, 0x4010040100000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000801002004ULL, 0x0080100200000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000801002004ULL, 0x0080100200000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000010080000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000010080000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000300000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000300000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000300000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000001004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000001004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000001004ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000000801ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000000801ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000000801ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000002010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000002010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000002010ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 3.
+static bitboard_t flipX4Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000003f000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000003f000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000020080200ULL, 0x8020080200000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020080200ULL, 0x8020080200000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000002004008ULL, 0x0100200400000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000002004008ULL, 0x0100200400000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0004020100000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0004020100000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000700000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000700000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000700000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000002008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000002008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000002008ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000001002ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000001002ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000001002ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000004020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000004020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000004020ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 3.
+static bitboard_t flipX5Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000003e000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000003e000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000040100401ULL, 0x0040100400000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040100401ULL, 0x0040100400000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000008010ULL, 0x0200400800000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000008010ULL, 0x0200400800000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x1008040200000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x1008040200000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000f00000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000f00000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000f00000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000004010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000004010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000004010ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000002004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000002004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000002004ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000008040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000008040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000008040ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 3.
+static bitboard_t flipX6Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000003c000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000003c000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000080200802ULL, 0x0080200800000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080200802ULL, 0x0080200800000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000020ULL, 0x0400801000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000020ULL, 0x0400801000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000040ULL, 0x2010080400000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000040ULL, 0x2010080400000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000001f00000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000001f00000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000001f00000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000008020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000008020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000008020ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000004008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000004008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000004008ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000010080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000010080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000010080ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 3.
+static bitboard_t flipX7Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000000038000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000000038000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000100401004ULL, 0x0100401000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100401004ULL, 0x0100401000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0801002000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0801002000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000010080ULL, 0x4020100800000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000010080ULL, 0x4020100800000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000003f00000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000003f00000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000003f00000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000010040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000010040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000010040ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000008010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000008010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000008010ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000020100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000020100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000020100ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 3.
+static bitboard_t flipX8Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0000000030000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0000000030000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000200802008ULL, 0x0200802000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200802008ULL, 0x0200802000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0002004000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0002004000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000004020100ULL, 0x8040201000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004020100ULL, 0x8040201000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000007f00000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000007f00000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000007f00000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000020080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000020080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000020080ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000010020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000010020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000010020ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000040200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000040200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000040200ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 9 y 3.
+static bitboard_t flipX9Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000401004010ULL, 0x0401004000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000401004010ULL, 0x0401004000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000008040201ULL, 0x0080402000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008040201ULL, 0x0080402000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x000000000ff00000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x000000000ff00000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x000000000ff00000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000040100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000040100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000040100ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000020040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000020040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000020040ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 10 y 3.
+static bitboard_t flipX10Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000802008020ULL, 0x0802008000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000802008020ULL, 0x0802008000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000010080402ULL, 0x0100804000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010080402ULL, 0x0100804000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x000000001ff00000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x000000001ff00000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x000000001ff00000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000080200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000080200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000080200ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000040080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000040080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000040080ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 4.
+static bitboard_t flipX1Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000ff80000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000ff80000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000004010040ULL, 0x1004010000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004010040ULL, 0x1004010000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000100200400ULL, 0x8010020000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100200400ULL, 0x8010020000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000100401ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000100401ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000100401ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000201008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000201008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000201008ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 4.
+static bitboard_t flipX2Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000ff00000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000ff00000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000008020080ULL, 0x2008020000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008020080ULL, 0x2008020000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000200400801ULL, 0x0020040000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200400801ULL, 0x0020040000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000200802ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000200802ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000200802ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000402010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000402010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000402010ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 4.
+static bitboard_t flipX3Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000fe00000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000fe00000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000010040100ULL, 0x4010040000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010040100ULL, 0x4010040000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000400801002ULL, 0x0040080000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000400801002ULL, 0x0040080000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0004020000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0004020000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x00000000c0000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x00000000c0000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x00000000c0000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000401004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000401004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000401004ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000200400ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000200400ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000200400ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000804020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000804020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000804020ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 4.
+static bitboard_t flipX4Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000fc00000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000fc00000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000020080200ULL, 0x8020080000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020080200ULL, 0x8020080000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000801002004ULL, 0x0080100000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000801002004ULL, 0x0080100000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x1008040000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x1008040000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x00000001c0000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x00000001c0000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x00000001c0000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000802008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000802008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000802008ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000400801ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000400801ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000400801ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000001008040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000001008040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000001008040ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 4.
+static bitboard_t flipX5Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000f800000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000f800000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000040100401ULL, 0x0040100000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040100401ULL, 0x0040100000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000002004008ULL, 0x0100200000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000002004008ULL, 0x0100200000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000040ULL, 0x2010080000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000040ULL, 0x2010080000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x00000003c0000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x00000003c0000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x00000003c0000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000001004010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000001004010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000001004010ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000000801002ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000000801002ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000000801002ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000002010080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000002010080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000002010080ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 4.
+static bitboard_t flipX6Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000f000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000f000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000080200802ULL, 0x0080200000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080200802ULL, 0x0080200000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000008010ULL, 0x0200400000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000008010ULL, 0x0200400000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000010080ULL, 0x4020100000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000010080ULL, 0x4020100000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x00000007c0000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x00000007c0000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x00000007c0000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000002008020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000002008020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000002008020ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000001002004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000001002004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000001002004ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000004020100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000004020100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000004020100ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 4.
+static bitboard_t flipX7Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000e000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000e000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000100401004ULL, 0x0100400000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100401004ULL, 0x0100400000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000020ULL, 0x0400800000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000020ULL, 0x0400800000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000004020100ULL, 0x8040200000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004020100ULL, 0x8040200000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000fc0000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000fc0000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000fc0000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000004010040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000004010040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000004010040ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000002004008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000002004008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000002004008ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000008040200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000008040200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000008040200ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 4.
+static bitboard_t flipX8Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x000000c000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x000000c000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000200802008ULL, 0x0200800000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200802008ULL, 0x0200800000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0801000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0801000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000008040201ULL, 0x0080400000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008040201ULL, 0x0080400000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000001fc0000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000001fc0000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000001fc0000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000008020080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000008020080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000008020080ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000004008010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000004008010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000004008010ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000010080000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000010080000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000010080000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 9 y 4.
+static bitboard_t flipX9Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000401004010ULL, 0x0401000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000401004010ULL, 0x0401000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000010080402ULL, 0x0100800000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010080402ULL, 0x0100800000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000003fc0000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000003fc0000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000003fc0000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000010040100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000010040100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000010040100ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000008010020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000008010020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000008010020ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 10 y 4.
+static bitboard_t flipX10Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000802008020ULL, 0x0802000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000802008020ULL, 0x0802000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000020100804ULL, 0x0201000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020100804ULL, 0x0201000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000007fc0000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000007fc0000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000007fc0000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000020080200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000020080200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000020080200ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000010020040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000010020040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000010020040ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 5.
+static bitboard_t flipX1Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0003fe0000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0003fe0000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000004010040ULL, 0x1004000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004010040ULL, 0x1004000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000080100200ULL, 0x4008000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080100200ULL, 0x4008000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000040100401ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000040100401ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000040100401ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000080402010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000080402010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000080402010ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 5.
+static bitboard_t flipX2Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0003fc0000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0003fc0000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000008020080ULL, 0x2008000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008020080ULL, 0x2008000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000100200400ULL, 0x8010000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100200400ULL, 0x8010000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000080200802ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000080200802ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000080200802ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000100804020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000100804020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000100804020ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 5.
+static bitboard_t flipX3Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0003f80000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0003f80000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000010040100ULL, 0x4010000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010040100ULL, 0x4010000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000200400801ULL, 0x0020000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200400801ULL, 0x0020000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x1008000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x1008000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000030000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000030000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000030000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000100401004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000100401004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000100401004ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000080100000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000080100000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000080100000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000201008040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000201008040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000201008040ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 5.
+static bitboard_t flipX4Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0003f00000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0003f00000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000020080200ULL, 0x8020000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020080200ULL, 0x8020000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000400801002ULL, 0x0040000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000400801002ULL, 0x0040000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000040ULL, 0x2010000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000040ULL, 0x2010000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000070000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000070000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000070000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000200802008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000200802008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000200802008ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000100200400ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000100200400ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000100200400ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000402010080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000402010080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000402010080ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 5.
+static bitboard_t flipX5Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0003e00000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0003e00000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000040100401ULL, 0x0040000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040100401ULL, 0x0040000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000801002004ULL, 0x0080000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000801002004ULL, 0x0080000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000010080ULL, 0x4020000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000010080ULL, 0x4020000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x00000f0000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x00000f0000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x00000f0000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000401004010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000401004010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000401004010ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000200400801ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000200400801ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000200400801ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000804020100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000804020100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000804020100ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 5.
+static bitboard_t flipX6Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0003c00000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0003c00000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000080200802ULL, 0x0080000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080200802ULL, 0x0080000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000002004008ULL, 0x0100000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000002004008ULL, 0x0100000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000004020100ULL, 0x8040000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004020100ULL, 0x8040000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x00001f0000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x00001f0000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x00001f0000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000802008020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000802008020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000802008020ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000400801002ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000400801002ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000400801002ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000001008040200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000001008040200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000001008040200ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 5.
+static bitboard_t flipX7Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0003800000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0003800000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000100401004ULL, 0x0100000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100401004ULL, 0x0100000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000008010ULL, 0x0200000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000008010ULL, 0x0200000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000008040201ULL, 0x0080000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008040201ULL, 0x0080000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x00003f0000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x00003f0000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x00003f0000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000001004010040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000001004010040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000001004010040ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000000801002004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000000801002004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000000801002004ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000002010080000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000002010080000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000002010080000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 5.
+static bitboard_t flipX8Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0003000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0003000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000200802008ULL, 0x0200000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200802008ULL, 0x0200000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000000020ULL, 0x0400000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000020ULL, 0x0400000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000010080402ULL, 0x0100000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010080402ULL, 0x0100000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x00007f0000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x00007f0000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x00007f0000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000002008020080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000002008020080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000002008020080ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000001002004008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000001002004008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000001002004008ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000004020000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000004020000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000004020000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 9 y 5.
+static bitboard_t flipX9Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000401004010ULL, 0x0400000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000401004010ULL, 0x0400000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000020100804ULL, 0x0200000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020100804ULL, 0x0200000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000ff0000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000ff0000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000ff0000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000004010040100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000004010040100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000004010040100ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000002004008010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000002004008010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000002004008010ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 10 y 5.
+static bitboard_t flipX10Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000802008020ULL, 0x0800000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000802008020ULL, 0x0800000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000040201008ULL, 0x0400000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040201008ULL, 0x0400000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0001ff0000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0001ff0000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0001ff0000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000008020080200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000008020080200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000008020080200ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000004008010020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000004008010020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000004008010020ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 6.
+static bitboard_t flipX1Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0ff8000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0ff8000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000004010040ULL, 0x1000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004010040ULL, 0x1000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000040080100ULL, 0x2000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040080100ULL, 0x2000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000010040100401ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000010040100401ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000010040100401ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000020100804020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000020100804020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000020100804020ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 6.
+static bitboard_t flipX2Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0ff0000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0ff0000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000008020080ULL, 0x2000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008020080ULL, 0x2000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000080100200ULL, 0x4000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080100200ULL, 0x4000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000020080200802ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000020080200802ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000020080200802ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000040201008040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000040201008040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000040201008040ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 6.
+static bitboard_t flipX3Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0fe0000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0fe0000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000010040100ULL, 0x4000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010040100ULL, 0x4000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000100200400ULL, 0x8000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100200400ULL, 0x8000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000000040ULL, 0x2000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000040ULL, 0x2000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x000c000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x000c000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x000c000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000040100401004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000040100401004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000040100401004ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000020040000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000020040000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000020040000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000080402010080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000080402010080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000080402010080ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 6.
+static bitboard_t flipX4Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0fc0000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0fc0000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000020080200ULL, 0x8000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020080200ULL, 0x8000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000200400801ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200400801ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000010080ULL, 0x4000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000010080ULL, 0x4000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x001c000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x001c000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x001c000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000080200802008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000080200802008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000080200802008ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000040080100000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000040080100000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000040080100000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000100804020100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000100804020100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000100804020100ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 6.
+static bitboard_t flipX5Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0f80000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0f80000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000040100401ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040100401ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000400801002ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000400801002ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000004020100ULL, 0x8000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004020100ULL, 0x8000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x003c000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x003c000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x003c000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000100401004010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000100401004010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000100401004010ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000080100200400ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000080100200400ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000080100200400ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000201008040200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000201008040200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000201008040200ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 6.
+static bitboard_t flipX6Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0f00000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0f00000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000080200802ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080200802ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000801002004ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000801002004ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000008040201ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008040201ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x007c000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x007c000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x007c000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000200802008020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000200802008020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000200802008020ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000100200400801ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000100200400801ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000100200400801ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000402010080000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000402010080000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000402010080000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 6.
+static bitboard_t flipX7Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0e00000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0e00000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000100401004ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100401004ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000002004008ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000002004008ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000010080402ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010080402ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x00fc000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x00fc000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x00fc000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000401004010040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000401004010040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000401004010040ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000200400801002ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000200400801002ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000200400801002ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000804020000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000804020000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000804020000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 6.
+static bitboard_t flipX8Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000000ULL, 0x0c00000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000000ULL, 0x0c00000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000200802008ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200802008ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000000008010ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000008010ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000020100804ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020100804ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x01fc000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x01fc000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x01fc000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000802008020080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000802008020080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000802008020080ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000400801002004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000400801002004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000400801002004ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0001008000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0001008000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0001008000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 9 y 6.
+static bitboard_t flipX9Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000401004010ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000401004010ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000040201008ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040201008ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x03fc000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x03fc000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x03fc000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0001004010040100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0001004010040100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0001004010040100ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0000801002004008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0000801002004008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0000801002004008ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 10 y 6.
+static bitboard_t flipX10Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000802008020ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000802008020ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000080402010ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080402010ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x07fc000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x07fc000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x07fc000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0002008020080200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0002008020080200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0002008020080200ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0001002004008010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0001002004008010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0001002004008010ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 7.
+static bitboard_t flipX1Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000003fULL, 0xe000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000003fULL, 0xe000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000004010040ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004010040ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000020040080ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020040080ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0004010040100401ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0004010040100401ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0004010040100401ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0008040201008040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0008040201008040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0008040201008040ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 7.
+static bitboard_t flipX2Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000003fULL, 0xc000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000003fULL, 0xc000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000008020080ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008020080ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000040080100ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040080100ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0008020080200802ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0008020080200802ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0008020080200802ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0010080402010080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0010080402010080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0010080402010080ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 7.
+static bitboard_t flipX3Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000003fULL, 0x8000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000003fULL, 0x8000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000010040100ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010040100ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000080100200ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080100200ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000000010080ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000010080ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x3000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x3000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x3000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0010040100401004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0010040100401004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0010040100401004ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0008010000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0008010000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0008010000000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0020100804020100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0020100804020100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0020100804020100ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 7.
+static bitboard_t flipX4Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000003fULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000003fULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000020080200ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020080200ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000100200400ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100200400ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000004020100ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004020100ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x7000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x7000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x7000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0020080200802008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0020080200802008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0020080200802008ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0010020040000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0010020040000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0010020040000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0040201008040200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0040201008040200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0040201008040200ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 7.
+static bitboard_t flipX5Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000003eULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000003eULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000040100400ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040100400ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000200400800ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200400800ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000008040200ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008040200ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0xf000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0xf000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0xf000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0040100401004010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0040100401004010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0040100401004010ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0020040080100000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0020040080100000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0020040080100000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0080402010080000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0080402010080000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0080402010080000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 7.
+static bitboard_t flipX6Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000003cULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000003cULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000080200800ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080200800ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000400801000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000400801000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000010080400ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010080400ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000001ULL, 0xf000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000001ULL, 0xf000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000001ULL, 0xf000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0080200802008020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0080200802008020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0080200802008020ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0040080100200400ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0040080100200400ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0040080100200400ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0100804020000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0100804020000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0100804020000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 7.
+static bitboard_t flipX7Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000038ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000038ULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000100401000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100401000ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000801002000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000801002000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000020100800ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020100800ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000003ULL, 0xf000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000003ULL, 0xf000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000003ULL, 0xf000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0100401004010040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0100401004010040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0100401004010040ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0080100200400801ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0080100200400801ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0080100200400801ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0201008000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0201008000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0201008000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 7.
+static bitboard_t flipX8Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000000000030ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000000000030ULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000200802000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200802000ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000002004000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000002004000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000040201000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040201000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000007ULL, 0xf000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000007ULL, 0xf000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000007ULL, 0xf000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0200802008020080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0200802008020080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0200802008020080ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0100200400801002ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0100200400801002ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0100200400801002ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0402000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0402000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0402000000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 9 y 7.
+static bitboard_t flipX9Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000401004000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000401004000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000080402000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080402000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x000000000000000fULL, 0xf000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x000000000000000fULL, 0xf000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x000000000000000fULL, 0xf000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0401004010040100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0401004010040100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0401004010040100ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0200400801002004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0200400801002004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0200400801002004ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 10 y 7.
+static bitboard_t flipX10Y7(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000802008000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000802008000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000100804000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100804000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x000000000000001fULL, 0xf000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x000000000000001fULL, 0xf000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x000000000000001fULL, 0xf000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0802008020080200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0802008020080200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0802008020080200ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x0400801002004008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x0400801002004008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x0400801002004008ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 8.
+static bitboard_t flipX1Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000ff80ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000ff80ULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000004010000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004010000ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000010020000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010020000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x1004010040100401ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x1004010040100401ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x1004010040100401ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x2010080402010080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x2010080402010080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x2010080402010080ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 8.
+static bitboard_t flipX2Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000ff00ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000ff00ULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000008020000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008020000ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000020040000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020040000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x2008020080200802ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x2008020080200802ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x2008020080200802ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x4020100804020100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x4020100804020100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x4020100804020100ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 8.
+static bitboard_t flipX3Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000fe00ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000fe00ULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000010040000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010040000ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000040080000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040080000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000004020000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000004020000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000000000000c0ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000000000000c0ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000000000000c0ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x4010040100401004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x4010040100401004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x4010040100401004ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x2004000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x2004000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x2004000000000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x8040201008040200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x8040201008040200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x8040201008040200ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 8.
+static bitboard_t flipX4Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000fc00ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000fc00ULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000020080000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020080000ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000080100000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080100000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000008040000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000008040000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000000000001c0ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000000000001c0ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000000000001c0ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x8020080200802008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x8020080200802008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x8020080200802008ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x4008010000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x4008010000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x4008010000000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000001ULL, 0x0080402010080000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000001ULL, 0x0080402010080000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000001ULL, 0x0080402010080000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 8.
+static bitboard_t flipX5Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000f800ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000f800ULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000040100000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040100000ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000100200000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100200000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000010080000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000010080000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000000000003c0ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000000000003c0ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000000000003c0ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000001ULL, 0x0040100401004010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000001ULL, 0x0040100401004010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000001ULL, 0x0040100401004010ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000000ULL, 0x8010020040000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000000ULL, 0x8010020040000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000000ULL, 0x8010020040000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000002ULL, 0x0100804020000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000002ULL, 0x0100804020000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000002ULL, 0x0100804020000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 8.
+static bitboard_t flipX6Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000f000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000f000ULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000080200000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080200000ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000200400000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200400000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000020100000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000020100000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000000000007c0ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000000000007c0ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000000000007c0ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000002ULL, 0x0080200802008020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000002ULL, 0x0080200802008020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000002ULL, 0x0080200802008020ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000001ULL, 0x0020040080100000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000001ULL, 0x0020040080100000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000001ULL, 0x0020040080100000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000004ULL, 0x0201008000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000004ULL, 0x0201008000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000004ULL, 0x0201008000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 8.
+static bitboard_t flipX7Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000e000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000e000ULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000100400000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100400000ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000400800000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000400800000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000040200000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000040200000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000000fc0ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000fc0ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000fc0ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000004ULL, 0x0100401004010040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000004ULL, 0x0100401004010040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000004ULL, 0x0100401004010040ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000002ULL, 0x0040080100200400ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000002ULL, 0x0040080100200400ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000002ULL, 0x0040080100200400ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000008ULL, 0x0402000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000008ULL, 0x0402000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000008ULL, 0x0402000000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 8.
+static bitboard_t flipX8Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x000000000000c000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x000000000000c000ULL, 0x0000000000000000ULL);
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000200800000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000200800000ULL, 0x0000000000000000ULL);
+
+	// Down and right.
+	o = ~opp & BITBOARD(0x0000000801000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000801000000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000080400000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000080400000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000001fc0ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000001fc0ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000001fc0ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000008ULL, 0x0200802008020080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000008ULL, 0x0200802008020080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000008ULL, 0x0200802008020080ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000004ULL, 0x0080100200400801ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000004ULL, 0x0080100200400801ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000004ULL, 0x0080100200400801ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000010ULL, 0x0800000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000010ULL, 0x0800000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000010ULL, 0x0800000000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 9 y 8.
+static bitboard_t flipX9Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000401000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000401000000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000100800000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000100800000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000003fc0ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000003fc0ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000003fc0ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000010ULL, 0x0401004010040100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000010ULL, 0x0401004010040100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000010ULL, 0x0401004010040100ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000008ULL, 0x0100200400801002ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000008ULL, 0x0100200400801002ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000008ULL, 0x0100200400801002ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 10 y 8.
+static bitboard_t flipX10Y8(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & BITBOARD(0x0000000802000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000802000000ULL, 0x0000000000000000ULL);
+
+	// Down and left.
+	o = ~opp & BITBOARD(0x0000000201000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000201000000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000007fc0ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000007fc0ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000007fc0ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000020ULL, 0x0802008020080200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000020ULL, 0x0802008020080200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000020ULL, 0x0802008020080200ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000010ULL, 0x0200400801002004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000010ULL, 0x0200400801002004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000010ULL, 0x0200400801002004ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 9.
+static bitboard_t flipX1Y9(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000003fe0000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000003fe0000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000040ULL, 0x1004010040100401ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000040ULL, 0x1004010040100401ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000040ULL, 0x1004010040100401ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000080ULL, 0x4020100804020100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000080ULL, 0x4020100804020100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000080ULL, 0x4020100804020100ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 9.
+static bitboard_t flipX2Y9(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000003fc0000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000003fc0000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000080ULL, 0x2008020080200802ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000080ULL, 0x2008020080200802ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000080ULL, 0x2008020080200802ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000100ULL, 0x8040201008040200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000100ULL, 0x8040201008040200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000100ULL, 0x8040201008040200ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 9.
+static bitboard_t flipX3Y9(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000003f80000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000003f80000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000030000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000030000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000030000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000100ULL, 0x4010040100401004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000100ULL, 0x4010040100401004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000100ULL, 0x4010040100401004ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000080ULL, 0x1000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000080ULL, 0x1000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000080ULL, 0x1000000000000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000201ULL, 0x0080402010080000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000201ULL, 0x0080402010080000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000201ULL, 0x0080402010080000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 9.
+static bitboard_t flipX4Y9(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000003f00000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000003f00000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000070000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000070000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000070000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000200ULL, 0x8020080200802008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000200ULL, 0x8020080200802008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000200ULL, 0x8020080200802008ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000100ULL, 0x2004000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000100ULL, 0x2004000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000100ULL, 0x2004000000000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000402ULL, 0x0100804020000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000402ULL, 0x0100804020000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000402ULL, 0x0100804020000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 9.
+static bitboard_t flipX5Y9(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000003e00000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000003e00000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000000000f0000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000000000f0000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000000000f0000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000401ULL, 0x0040100401004010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000401ULL, 0x0040100401004010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000401ULL, 0x0040100401004010ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000200ULL, 0x4008010000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000200ULL, 0x4008010000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000200ULL, 0x4008010000000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000000804ULL, 0x0201008000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000804ULL, 0x0201008000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000804ULL, 0x0201008000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 9.
+static bitboard_t flipX6Y9(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000003c00000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000003c00000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000000001f0000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000000001f0000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000000001f0000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000000802ULL, 0x0080200802008020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000802ULL, 0x0080200802008020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000802ULL, 0x0080200802008020ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000400ULL, 0x8010020040000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000400ULL, 0x8010020040000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000400ULL, 0x8010020040000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000001008ULL, 0x0402000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000001008ULL, 0x0402000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000001008ULL, 0x0402000000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 9.
+static bitboard_t flipX7Y9(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000003800000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000003800000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000000003f0000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000000003f0000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000000003f0000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000001004ULL, 0x0100401004010040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000001004ULL, 0x0100401004010040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000001004ULL, 0x0100401004010040ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000000801ULL, 0x0020040080100000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000000801ULL, 0x0020040080100000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000000801ULL, 0x0020040080100000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000002010ULL, 0x0800000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000002010ULL, 0x0800000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000002010ULL, 0x0800000000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 9.
+static bitboard_t flipX8Y9(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000003000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000003000000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000000007f0000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000000007f0000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000000007f0000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000002008ULL, 0x0200802008020080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000002008ULL, 0x0200802008020080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000002008ULL, 0x0200802008020080ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000001002ULL, 0x0040080100200400ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000001002ULL, 0x0040080100200400ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000001002ULL, 0x0040080100200400ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000004020ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000004020ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000004020ULL, 0x0000000000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 9 y 9.
+static bitboard_t flipX9Y9(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000000ff0000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000ff0000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000ff0000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000004010ULL, 0x0401004010040100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000004010ULL, 0x0401004010040100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000004010ULL, 0x0401004010040100ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000002004ULL, 0x0080100200400801ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000002004ULL, 0x0080100200400801ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000002004ULL, 0x0080100200400801ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 10 y 9.
+static bitboard_t flipX10Y9(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & BITBOARD(0x0000000001ff0000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000001ff0000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000001ff0000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000008020ULL, 0x0802008020080200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000008020ULL, 0x0802008020080200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000008020ULL, 0x0802008020080200ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000004008ULL, 0x0100200400801002ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000004008ULL, 0x0100200400801002ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000004008ULL, 0x0100200400801002ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 10.
+static bitboard_t flipX1Y10(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000ff8000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000ff8000000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000010040ULL, 0x1004010040100401ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000010040ULL, 0x1004010040100401ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000010040ULL, 0x1004010040100401ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000020100ULL, 0x8040201008040200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000020100ULL, 0x8040201008040200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000020100ULL, 0x8040201008040200ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 10.
+static bitboard_t flipX2Y10(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000ff0000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000ff0000000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000020080ULL, 0x2008020080200802ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000020080ULL, 0x2008020080200802ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000020080ULL, 0x2008020080200802ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000040201ULL, 0x0080402010080000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000040201ULL, 0x0080402010080000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000040201ULL, 0x0080402010080000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 10.
+static bitboard_t flipX3Y10(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000fe0000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000fe0000000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x000000000c000000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x000000000c000000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x000000000c000000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000040100ULL, 0x4010040100401004ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000040100ULL, 0x4010040100401004ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000040100ULL, 0x4010040100401004ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000020040ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000020040ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000020040ULL, 0x0000000000000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000080402ULL, 0x0100804020000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000080402ULL, 0x0100804020000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000080402ULL, 0x0100804020000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 10.
+static bitboard_t flipX4Y10(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000fc0000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000fc0000000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x000000001c000000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x000000001c000000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x000000001c000000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000080200ULL, 0x8020080200802008ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000080200ULL, 0x8020080200802008ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000080200ULL, 0x8020080200802008ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000040080ULL, 0x1000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000040080ULL, 0x1000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000040080ULL, 0x1000000000000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000100804ULL, 0x0201008000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000100804ULL, 0x0201008000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000100804ULL, 0x0201008000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 10.
+static bitboard_t flipX5Y10(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000f80000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000f80000000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x000000003c000000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x000000003c000000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x000000003c000000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000100401ULL, 0x0040100401004010ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000100401ULL, 0x0040100401004010ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000100401ULL, 0x0040100401004010ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000080100ULL, 0x2004000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000080100ULL, 0x2004000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000080100ULL, 0x2004000000000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000201008ULL, 0x0402000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000201008ULL, 0x0402000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000201008ULL, 0x0402000000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 10.
+static bitboard_t flipX6Y10(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000f00000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000f00000000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x000000007c000000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x000000007c000000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x000000007c000000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000200802ULL, 0x0080200802008020ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000200802ULL, 0x0080200802008020ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000200802ULL, 0x0080200802008020ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000100200ULL, 0x4008010000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000100200ULL, 0x4008010000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000100200ULL, 0x4008010000000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000402010ULL, 0x0800000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000402010ULL, 0x0800000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000402010ULL, 0x0800000000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 7 y 10.
+static bitboard_t flipX7Y10(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000e00000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000e00000000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000000fc000000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000000fc000000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000000fc000000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000401004ULL, 0x0100401004010040ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000401004ULL, 0x0100401004010040ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000401004ULL, 0x0100401004010040ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000200400ULL, 0x8010020040000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000200400ULL, 0x8010020040000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000200400ULL, 0x8010020040000000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000000804020ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000804020ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000804020ULL, 0x0000000000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 8 y 10.
+static bitboard_t flipX8Y10(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & BITBOARD(0x0000000c00000000ULL, 0x0000000000000000ULL);
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & BITBOARD(0x0000000c00000000ULL, 0x0000000000000000ULL);
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000001fc000000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000001fc000000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000001fc000000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000000802008ULL, 0x0200802008020080ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000802008ULL, 0x0200802008020080ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000802008ULL, 0x0200802008020080ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000400801ULL, 0x0020040080100000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000400801ULL, 0x0020040080100000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000400801ULL, 0x0020040080100000ULL);
+
+	// Up and right.
+	o = (~opp & BITBOARD(0x0000000001008000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000001008000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000001008000ULL, 0x0000000000000000ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 9 y 10.
+static bitboard_t flipX9Y10(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000003fc000000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000003fc000000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000003fc000000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000001004010ULL, 0x0401004010040100ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000001004010ULL, 0x0401004010040100ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000001004010ULL, 0x0401004010040100ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000000801002ULL, 0x0040080100200400ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000000801002ULL, 0x0040080100200400ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000000801002ULL, 0x0040080100200400ULL);
+
+	return flips;
+}
+
+// Flips for a move at x 10 y 10.
+static bitboard_t flipX10Y10(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & BITBOARD(0x00000007fc000000ULL, 0x0000000000000000ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x00000007fc000000ULL, 0x0000000000000000ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x00000007fc000000ULL, 0x0000000000000000ULL);
+
+	// Up.
+	o = (~opp & BITBOARD(0x0000000002008020ULL, 0x0802008020080200ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000002008020ULL, 0x0802008020080200ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000002008020ULL, 0x0802008020080200ULL);
+
+	// Up and left.
+	o = (~opp & BITBOARD(0x0000000001002004ULL, 0x0080100200400801ULL)) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & BITBOARD(0x0000000001002004ULL, 0x0080100200400801ULL);
+	flips |= (0 - (t << 1)) & BITBOARD(0x0000000001002004ULL, 0x0080100200400801ULL);
+
+	return flips;
+}
+
+// Flip function for each square.
+static bitboard_t (* const flipKernel[100])(bitboard_t own, bitboard_t opp) =
+{
+	flipX1Y1, flipX2Y1, flipX3Y1, flipX4Y1, flipX5Y1, flipX6Y1, flipX7Y1, flipX8Y1, flipX9Y1, flipX10Y1,
+	flipX1Y2, flipX2Y2, flipX3Y2, flipX4Y2, flipX5Y2, flipX6Y2, flipX7Y2, flipX8Y2, flipX9Y2, flipX10Y2,
+	flipX1Y3, flipX2Y3, flipX3Y3, flipX4Y3, flipX5Y3, flipX6Y3, flipX7Y3, flipX8Y3, flipX9Y3, flipX10Y3,
+	flipX1Y4, flipX2Y4, flipX3Y4, flipX4Y4, flipX5Y4, flipX6Y4, flipX7Y4, flipX8Y4, flipX9Y4, flipX10Y4,
+	flipX1Y5, flipX2Y5, flipX3Y5, flipX4Y5, flipX5Y5, flipX6Y5, flipX7Y5, flipX8Y5, flipX9Y5, flipX10Y5,
+	flipX1Y6, flipX2Y6, flipX3Y6, flipX4Y6, flipX5Y6, flipX6Y6, flipX7Y6, flipX8Y6, flipX9Y6, flipX10Y6,
+	flipX1Y7, flipX2Y7, flipX3Y7, flipX4Y7, flipX5Y7, flipX6Y7, flipX7Y7, flipX8Y7, flipX9Y7, flipX10Y7,
+	flipX1Y8, flipX2Y8, flipX3Y8, flipX4Y8, flipX5Y8, flipX6Y8, flipX7Y8, flipX8Y8, flipX9Y8, flipX10Y8,
+	flipX1Y9, flipX2Y9, flipX3Y9, flipX4Y9, flipX5Y9, flipX6Y9, flipX7Y9, flipX8Y9, flipX9Y9, flipX10Y9,
+	flipX1Y10, flipX2Y10, flipX3Y10, flipX4Y10, flipX5Y10, flipX6Y10, flipX7Y10, flipX8Y10, flipX9Y10, flipX10Y10
+};
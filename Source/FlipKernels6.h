@@ -0,0 +1,1152 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* FlipKernels6 header, for the 6x6 board.
+//*
+//* GENERATED BY Tools/GenFlip.c, DO NOT EDIT. One flip function per square, selected through flipKernel[square].
+//* Only included when BOARDSIZE is 6.
+//*
+//* In each direction the nearest square that is not an opponent piece is found (the outflank square).
+//* If that square holds a player piece, the opponent pieces between it and the move are flipped.
+//*
+//************************************************************************************************************************
+#pragma once
+
+#include "Bitboard.h"	// Bitboard types and functions.
+
+// Flips for a move at x 1 y 1.
+static bitboard_t flipX1Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000000000003eULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000000000003eULL;
+
+	// Down.
+	o = ~opp & 0x0000000041041040ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000041041040ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000810204080ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000810204080ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 1.
+static bitboard_t flipX2Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000000000003cULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000000000003cULL;
+
+	// Down.
+	o = ~opp & 0x0000000082082080ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000082082080ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000020408100ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000020408100ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 1.
+static bitboard_t flipX3Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000000038ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000000038ULL;
+
+	// Down.
+	o = ~opp & 0x0000000104104100ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000104104100ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000000810200ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000810200ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000000001080ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000001080ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000000003ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000003ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000003ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 1.
+static bitboard_t flipX4Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000000030ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000000030ULL;
+
+	// Down.
+	o = ~opp & 0x0000000208208200ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000208208200ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000000020400ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000020400ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000000042100ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000042100ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000000007ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000007ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000007ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 1.
+static bitboard_t flipX5Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x0000000410410400ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000410410400ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000001084200ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000001084200ULL;
+
+	// Left.
+	o = (~opp & 0x000000000000000fULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000000000000fULL;
+	flips |= (0 - (t << 1)) & 0x000000000000000fULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 1.
+static bitboard_t flipX6Y1(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x0000000820820800ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000820820800ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000042108400ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000042108400ULL;
+
+	// Left.
+	o = (~opp & 0x000000000000001fULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000000000001fULL;
+	flips |= (0 - (t << 1)) & 0x000000000000001fULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 2.
+static bitboard_t flipX1Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000000f80ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000000f80ULL;
+
+	// Down.
+	o = ~opp & 0x0000000041041000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000041041000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000408102000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000408102000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 2.
+static bitboard_t flipX2Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000000f00ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000000f00ULL;
+
+	// Down.
+	o = ~opp & 0x0000000082082000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000082082000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000810204000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000810204000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 2.
+static bitboard_t flipX3Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000000e00ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000000e00ULL;
+
+	// Down.
+	o = ~opp & 0x0000000104104000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000104104000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000020408000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000020408000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000000042000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000042000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000000000c0ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000000000c0ULL;
+	flips |= (0 - (t << 1)) & 0x00000000000000c0ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 2.
+static bitboard_t flipX4Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000000c00ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000000c00ULL;
+
+	// Down.
+	o = ~opp & 0x0000000208208000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000208208000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000000810000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000810000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000001084000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000001084000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000000001c0ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000000001c0ULL;
+	flips |= (0 - (t << 1)) & 0x00000000000001c0ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 2.
+static bitboard_t flipX5Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x0000000410410000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000410410000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000042108000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000042108000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000000003c0ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000000003c0ULL;
+	flips |= (0 - (t << 1)) & 0x00000000000003c0ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 2.
+static bitboard_t flipX6Y2(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x0000000820820000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000820820000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000084210000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000084210000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000000007c0ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000000007c0ULL;
+	flips |= (0 - (t << 1)) & 0x00000000000007c0ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 3.
+static bitboard_t flipX1Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000000003e000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000000003e000ULL;
+
+	// Down.
+	o = ~opp & 0x0000000041040000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000041040000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000204080000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000204080000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000000041ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000041ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000041ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000000084ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000084ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000084ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 3.
+static bitboard_t flipX2Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000000003c000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000000003c000ULL;
+
+	// Down.
+	o = ~opp & 0x0000000082080000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000082080000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000408100000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000408100000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000000082ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000082ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000082ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000000108ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000108ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000108ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 3.
+static bitboard_t flipX3Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000038000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000038000ULL;
+
+	// Down.
+	o = ~opp & 0x0000000104100000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000104100000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000810200000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000810200000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000001080000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000001080000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000003000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000003000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000003000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000000104ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000104ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000104ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000000081ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000081ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000081ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000000210ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000210ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000210ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 3.
+static bitboard_t flipX4Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000030000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000030000ULL;
+
+	// Down.
+	o = ~opp & 0x0000000208200000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000208200000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000020400000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000020400000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000042100000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000042100000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000000007000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000007000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000007000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000000208ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000208ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000208ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000000102ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000102ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000102ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000000420ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000420ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000420ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 3.
+static bitboard_t flipX5Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x0000000410400000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000410400000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000084200000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000084200000ULL;
+
+	// Left.
+	o = (~opp & 0x000000000000f000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000000000f000ULL;
+	flips |= (0 - (t << 1)) & 0x000000000000f000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000000410ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000410ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000410ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000000204ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000204ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000204ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 3.
+static bitboard_t flipX6Y3(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x0000000820800000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000820800000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000108400000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000108400000ULL;
+
+	// Left.
+	o = (~opp & 0x000000000001f000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000000001f000ULL;
+	flips |= (0 - (t << 1)) & 0x000000000001f000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000000820ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000820ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000820ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000000408ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000000408ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000000408ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 4.
+static bitboard_t flipX1Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000f80000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000f80000ULL;
+
+	// Down.
+	o = ~opp & 0x0000000041000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000041000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000102000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000102000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000001041ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000001041ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000001041ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000002108ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000002108ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000002108ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 4.
+static bitboard_t flipX2Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000f00000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000f00000ULL;
+
+	// Down.
+	o = ~opp & 0x0000000082000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000082000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000204000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000204000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000002082ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000002082ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000002082ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000004210ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000004210ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000004210ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 4.
+static bitboard_t flipX3Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000e00000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000e00000ULL;
+
+	// Down.
+	o = ~opp & 0x0000000104000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000104000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000408000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000408000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000042000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000042000000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000000c0000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000000c0000ULL;
+	flips |= (0 - (t << 1)) & 0x00000000000c0000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000004104ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000004104ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000004104ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000002040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000002040ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000002040ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000008420ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000008420ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000008420ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 4.
+static bitboard_t flipX4Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000000c00000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000000c00000ULL;
+
+	// Down.
+	o = ~opp & 0x0000000208000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000208000000ULL;
+
+	// Down and right.
+	o = ~opp & 0x0000000810000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000810000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000084000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000084000000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000001c0000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000001c0000ULL;
+	flips |= (0 - (t << 1)) & 0x00000000001c0000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000008208ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000008208ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000008208ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000004081ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000004081ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000004081ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000010800ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000010800ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000010800ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 4.
+static bitboard_t flipX5Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x0000000410000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000410000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000108000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000108000000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000003c0000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000003c0000ULL;
+	flips |= (0 - (t << 1)) & 0x00000000003c0000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000010410ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000010410ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000010410ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000008102ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000008102ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000008102ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 4.
+static bitboard_t flipX6Y4(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Down.
+	o = ~opp & 0x0000000820000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000820000000ULL;
+
+	// Down and left.
+	o = ~opp & 0x0000000210000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000210000000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000007c0000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000007c0000ULL;
+	flips |= (0 - (t << 1)) & 0x00000000007c0000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000020820ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000020820ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000020820ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000010204ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000010204ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000010204ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 5.
+static bitboard_t flipX1Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000003e000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000003e000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000041041ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000041041ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000041041ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000084210ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000084210ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000084210ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 5.
+static bitboard_t flipX2Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x000000003c000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x000000003c000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000082082ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000082082ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000082082ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000108420ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000108420ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000108420ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 5.
+static bitboard_t flipX3Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000038000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000038000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000003000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000003000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000003000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000104104ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000104104ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000104104ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000081000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000081000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000081000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000210800ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000210800ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000210800ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 5.
+static bitboard_t flipX4Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000030000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000030000000ULL;
+
+	// Left.
+	o = (~opp & 0x0000000007000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000007000000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000007000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000208208ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000208208ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000208208ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000102040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000102040ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000102040ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000000420000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000420000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000420000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 5.
+static bitboard_t flipX5Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & 0x000000000f000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000000f000000ULL;
+	flips |= (0 - (t << 1)) & 0x000000000f000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000410410ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000410410ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000410410ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000204081ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000204081ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000204081ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 5.
+static bitboard_t flipX6Y5(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & 0x000000001f000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x000000001f000000ULL;
+	flips |= (0 - (t << 1)) & 0x000000001f000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000000820820ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000820820ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000820820ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000000408102ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000000408102ULL;
+	flips |= (0 - (t << 1)) & 0x0000000000408102ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 1 y 6.
+static bitboard_t flipX1Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000f80000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000f80000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000001041041ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000001041041ULL;
+	flips |= (0 - (t << 1)) & 0x0000000001041041ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000002108420ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000002108420ULL;
+	flips |= (0 - (t << 1)) & 0x0000000002108420ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 2 y 6.
+static bitboard_t flipX2Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000f00000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000f00000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000002082082ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000002082082ULL;
+	flips |= (0 - (t << 1)) & 0x0000000002082082ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000004210800ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000004210800ULL;
+	flips |= (0 - (t << 1)) & 0x0000000004210800ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 3 y 6.
+static bitboard_t flipX3Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000e00000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000e00000000ULL;
+
+	// Left.
+	o = (~opp & 0x00000000c0000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000000c0000000ULL;
+	flips |= (0 - (t << 1)) & 0x00000000c0000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000004104104ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000004104104ULL;
+	flips |= (0 - (t << 1)) & 0x0000000004104104ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000002040000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000002040000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000002040000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000008420000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000008420000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000008420000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 4 y 6.
+static bitboard_t flipX4Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Right.
+	o = ~opp & 0x0000000c00000000ULL;
+	t = o & (0 - o) & own;
+	flips |= (t - (t != 0)) & 0x0000000c00000000ULL;
+
+	// Left.
+	o = (~opp & 0x00000001c0000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000001c0000000ULL;
+	flips |= (0 - (t << 1)) & 0x00000001c0000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000008208208ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000008208208ULL;
+	flips |= (0 - (t << 1)) & 0x0000000008208208ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000004081000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000004081000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000004081000ULL;
+
+	// Up and right.
+	o = (~opp & 0x0000000010800000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000010800000ULL;
+	flips |= (0 - (t << 1)) & 0x0000000010800000ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 5 y 6.
+static bitboard_t flipX5Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & 0x00000003c0000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000003c0000000ULL;
+	flips |= (0 - (t << 1)) & 0x00000003c0000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000010410410ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000010410410ULL;
+	flips |= (0 - (t << 1)) & 0x0000000010410410ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000008102040ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000008102040ULL;
+	flips |= (0 - (t << 1)) & 0x0000000008102040ULL;
+
+	return flips;
+}
+
+// Flips for a move at x 6 y 6.
+static bitboard_t flipX6Y6(bitboard_t own, bitboard_t opp)
+{
+	bitboard_t flips = 0;
+	bitboard_t o, t;
+
+	// Left.
+	o = (~opp & 0x00000007c0000000ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x00000007c0000000ULL;
+	flips |= (0 - (t << 1)) & 0x00000007c0000000ULL;
+
+	// Up.
+	o = (~opp & 0x0000000020820820ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000020820820ULL;
+	flips |= (0 - (t << 1)) & 0x0000000020820820ULL;
+
+	// Up and left.
+	o = (~opp & 0x0000000010204081ULL) | 1;
+	t = SQUAREBIT(lastSquare(o)) & own & 0x0000000010204081ULL;
+	flips |= (0 - (t << 1)) & 0x0000000010204081ULL;
+
+	return flips;
+}
+
+// Flip function for each square.
+static bitboard_t (* const flipKernel[36])(bitboard_t own, bitboard_t opp) =
+{
+	flipX1Y1, flipX2Y1, flipX3Y1, flipX4Y1, flipX5Y1, flipX6Y1,
+	flipX1Y2, flipX2Y2, flipX3Y2, flipX4Y2, flipX5Y2, flipX6Y2,
+	flipX1Y3, flipX2Y3, flipX3Y3, flipX4Y3, flipX5Y3, flipX6Y3,
+	flipX1Y4, flipX2Y4, flipX3Y4, flipX4Y4, flipX5Y4, flipX6Y4,
+	flipX1Y5, flipX2Y5, flipX3Y5, flipX4Y5, flipX5Y5, flipX6Y5,
+	flipX1Y6, flipX2Y6, flipX3Y6, flipX4Y6, flipX5Y6, flipX6Y6
+};
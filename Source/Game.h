@@ -12,24 +12,114 @@
 
 #include <stdbool.h>				// To use booleans.
 
+#include "Bitboard.h"				// Bitboard board representation.
+#include "Playout.h"				// Random number generator.
+#include "Hash.h"					// Transposition table for the computer move search.
+#include "Thread.h"					// Thread to work out the computer move while the display carries on.
+
 //#define PLAYSELF					// Defined constant used to adjust build for optimisation, rather than for human play.
 
-void clearGameTable(void);			// Clears the game table ready for a new game.
+enum difficulty_e { EASY, MEDIUM, HARD };	// Difficulty levels.
+
+#ifndef HASHMB
+#define HASHMB 8					// Megabytes for the computer move transposition table, can be set bigger for a host build.
+#endif
+
+#ifndef SOLVEEMPTIES
+#define SOLVEEMPTIES 16				// Empty squares from which HARD solves the game exactly in half its time, and plays perfectly
+#endif									// if it can. Each extra square makes the first solve several times slower.
+
+#ifndef WLDEMPTIES
+#define WLDEMPTIES 19				// Empty squares from which HARD tries to prove a win or draw, in half its time.
+#endif
+
+// Integer weightings used for calculating the computer move. These are variable to support optimisation. The first ones
+// score each move to put them in order for the search (and pick between moves it finds equally good), the rest are the
+// weightings of the evaluation the search uses.
+typedef struct weights weights_t;
+
+struct weights
+{
+	int EDG;	// Score for an edge position.
+	int EG2;	// Score for edge next to a corner we have.
+	int CNR;	// Score for a corner position.
+	int CNO;	// Score for possible corner for opponent.
+	int CN2;	// Score for possible corner next move.
+	int NCN;	// Score for playing next to an available corner.
+	int JIN;	// Score for a position in the quadrant near a corner the computer holds.
+	int BTW;	// Score for playing between opponent pieces (harder to flip).
+	int BTO;	// Score for playing between own pieces to fill in the gaps.
+	int DIG;	// Score for playing to take advantage of the opponent playing next to a corner.
+
+	// Weightings for the evaluation used by the search, in hundredths of a disc.
+	int COR;	// Score for each corner held.
+	int XSQ;	// Score for each piece diagonally next to an empty corner.
+	int CSQ;	// Score for each piece on an edge next to an empty corner.
+	int MOB;	// Score for each valid move more than the opponent.
+	int POT;	// Score for each empty square next to an opponent piece, more than the opponent has.
+};
+
+// Summary of the game board, worked out when first asked for after a move and then kept until the next move,
+// so the board checks made every frame cost nothing.
+typedef struct summary summary_t;
+
+struct summary
+{
+	bool upToDate;					// False once a move has been made, until the summary is worked out again.
+	unsigned int red;				// Number of red pieces.
+	unsigned int green;				// Number of green pieces.
+	bitboard_t redMoves;			// Valid moves for red.
+	bitboard_t greenMoves;			// Valid moves for green.
+};
 
-bool putMove(int xi, int yi);		// Put the player's move (identified by column x and row y numbers) into the game Table, returns true if move valid.
+// Everything needed to play one game, passed to each of the game functions.
+// Nothing is held in global data, so more than one game (or computer move) can be worked on at the same time.
+typedef struct engine engine_t;
 
-char getGameTable(int x, int y);	// Get a character from the game table for display. Identified by column and row.
+struct engine
+{
+	position_t position;			// Game board, from the point of view of the player to move.
+	char mover;						// Colour of the player to move in the position, 'R' or 'G'.
+	bitboard_t valid;				// Squares marked as valid moves.
+	summary_t summary;				// Piece counts and valid moves for the position.
+	enum difficulty_e difficulty;	// Difficulty level for the game (how far ahead the computer searches).
+	weights_t weights;				// Weightings used to calculate the computer move.
+	rng_t rng;						// Random numbers for the optimisation dummy player.
+	hashTable_t hash;				// Search results kept between computer moves.
+	thread_t moveThread;			// Thread working out the computer move.
+	bool thinking;					// Set from starting the computer move until it has been played.
+	bool moveReady;					// Set by moveThread when the move has been found, shared.
+	int chosenMove;					// Square of the computer move found.
+};
+
+void initEngine(engine_t* eng);		// Set up an engine with the default difficulty and weightings, and a cleared game table.
+
+void freeEngine(engine_t* eng);		// Free the memory used by an engine (its transposition table).
+
+void clearGameTable(engine_t* eng);	// Clears the game table ready for a new game.
+
+bool putMove(engine_t* eng, int xi, int yi, bitboard_t* flips);	// Put the player's move (identified by column x and row y numbers) into the game Table, returns true if move valid.
+									// The pieces flipped by the move are passed back in flips, for the display to animate.
+
+char getGameTable(const engine_t* eng, int x, int y);	// Get a character from the game table for display. Identified by column and row.
 									// The positions are numbered x 1-8 and y 1-8.
 									// 1,1 is top left, 8,1 is top right, 1,8 is bottom left and 8,8 is bottom right.
 
-void validRedMoves(void);			// Identify valid moves for Red (player) on the game table.
+void validRedMoves(engine_t* eng);	// Identify valid moves for Red (player) on the game table.
+
+bitboard_t computerMove(engine_t* eng);	// Call to calculate the computer move which is added to the game table, in the same manner as for the player.
+									// Returns the pieces flipped by the move, for the display to animate.
 
-void computerMove(void);			// Call to calculate the computer move which is added to the game table, in the same manner as for the player.
+void startComputerMove(engine_t* eng);	// Start working out the computer move on a thread of its own, so the display and inputs
+									// carry on while it searches. The game table must not be changed until the move is played.
 
-void validGreenMoves(void);			// Identify valid moves for Green (computer) on the game table.
+bool pollComputerMove(engine_t* eng, bitboard_t* flips);	// Check whether the computer move has been found. If it has, it is
+									// played in the same manner as computerMove, the pieces flipped passed back in flips, and true
+									// returned.
 
-char checkBoard(char pl, unsigned int* red, unsigned int* green);	// Check the state of the board 'B' is for both players, 'R' for red and 'G' for green.
+void validGreenMoves(engine_t* eng);	// Identify valid moves for Green (computer) on the game table.
+
+char checkBoard(engine_t* eng, char pl, unsigned int* red, unsigned int* green);	// Check the state of the board 'B' is for both players, 'R' for red and 'G' for green.
 									// For both players the function returns whether the game has ended 'E' or ' ' for not ended.
 									// If 'R' or 'G' is selected it returns 'M' for miss a turn if there are no valid moves for that player, or ' ' if there are valid moves.
 									// In all cases the red and green piece counts are updated.
-
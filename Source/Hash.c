@@ -0,0 +1,174 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Hash
+//*
+//* Transposition table. Each bucket has three entries that keep the deepest results (the ones that took longest to work
+//* out), and one entry that is always replaced so that recent results near the end of the search are kept too.
+//*
+//************************************************************************************************************************
+#include <stdlib.h>			// For malloc and free.
+#include <string.h>			// For memset and memcpy.
+
+#include "Hash.h"			// Transposition table API.
+
+#define CACHELINE 64		// Bytes in a cache line, the buckets are aligned to this.
+
+// Start with an empty table.
+void initHash(hashTable_t* hash)
+{
+	hash->buckets = NULL;
+	hash->memory = NULL;
+	hash->mask = 0;
+	hash->age = 0;
+}
+
+// Allocate the buckets, as many as fit in the memory. malloc does not align to a cache line, so a line extra is
+// allocated and the buckets start at the first cache line boundary.
+bool resizeHash(hashTable_t* hash, size_t megabytes)
+{
+	size_t bytes = megabytes << 20;
+	size_t n = 1;
+
+	freeHash(hash);
+	if (bytes < sizeof(hashBucket_t)) { return true; }	// No table.
+
+	while (n * 2 * sizeof(hashBucket_t) <= bytes) { n *= 2; }
+
+	hash->memory = malloc((n * sizeof(hashBucket_t)) + CACHELINE);
+	if (hash->memory == NULL) { return false; }
+
+	hash->buckets = (hashBucket_t*)(((uintptr_t)hash->memory + CACHELINE - 1) & ~(uintptr_t)(CACHELINE - 1));
+	hash->mask = n - 1;
+	clearHash(hash);
+	return true;
+}
+
+// Free the memory, leaving an empty table.
+void freeHash(hashTable_t* hash)
+{
+	free(hash->memory);
+	initHash(hash);
+}
+
+// Empty every entry.
+void clearHash(hashTable_t* hash)
+{
+	if (hash->buckets != NULL) { memset(hash->buckets, 0, (size_t)(hash->mask + 1) * sizeof(hashBucket_t)); }
+	hash->age = 0;
+}
+
+// Start a new search. The age wraps round, which only means a very old entry may look new.
+void newSearchHash(hashTable_t* hash)
+{
+	hash->age++;
+}
+
+// The entries are shared by all of the search threads without any locking, so one thread can read an entry while another
+// is part way through writing it (on the Wii U even each 64-bit half is written as two 32-bit words). To catch this the
+// key is stored XORed with the second half of the entry (the data), so an entry read with its halves from different
+// writes does not match its key.
+static inline uint64_t entryData(const hashEntry_t* e)
+{
+	uint64_t data;
+
+	memcpy(&data, (const char*)e + sizeof(uint64_t), sizeof(data));
+	return data;
+}
+
+// Copy an entry to or from the table. Where 64-bit words can be read and written in one go, the two halves are copied
+// that way, so the threads reading and writing the same entry do not make a data race. Elsewhere (the Wii U) it is a
+// plain copy, and a copy made part way through a write is caught by the key check.
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__GCC_ATOMIC_LLONG_LOCK_FREE) && (__GCC_ATOMIC_LLONG_LOCK_FREE == 2)
+typedef uint64_t __attribute__((may_alias)) hashWord_t;
+
+static inline void copyEntry(hashEntry_t* to, const hashEntry_t* from)
+{
+	const hashWord_t* src = (const hashWord_t*)from;
+	hashWord_t* dst = (hashWord_t*)to;
+
+	__atomic_store_n(&dst[0], __atomic_load_n(&src[0], __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+	__atomic_store_n(&dst[1], __atomic_load_n(&src[1], __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+}
+#else
+static inline void copyEntry(hashEntry_t* to, const hashEntry_t* from)
+{
+	memcpy(to, from, sizeof(hashEntry_t));
+}
+#endif
+
+// Take a copy of an entry, with the key as stored (still XORed with the data).
+static inline void readEntry(const hashEntry_t* e, hashEntry_t* copy)
+{
+	copyEntry(copy, e);
+}
+
+// Look for the position in its bucket, and copy its entry.
+bool probeHash(const hashTable_t* hash, uint64_t key, hashEntry_t* entry)
+{
+	if (hash->buckets == NULL) { return false; }
+
+	const hashBucket_t* b = &hash->buckets[key & hash->mask];
+
+	for (int a = 0; a < BUCKETSIZE; a++)
+	{
+		readEntry(&b->entry[a], entry);
+		if (((entry->key ^ entryData(entry)) == key) && (entry->bound != BOUND_NONE))
+		{
+			entry->key = key;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Store a result. An entry already held for the position is updated. Otherwise the result replaces the shallowest of
+// the deep entries, preferring entries from old searches, as long as it is at least as deep. If it is not, it goes in
+// the entry that is always replaced. The choice is made from copies of the entries, as other threads may be changing them.
+void storeHash(hashTable_t* hash, uint64_t key, int depth, int score, int bound, int move)
+{
+	if (hash->buckets == NULL) { return; }
+
+	hashBucket_t* b = &hash->buckets[key & hash->mask];
+	hashEntry_t slot[BUCKETSIZE];
+	int e = -1;
+
+	for (int a = 0; a < BUCKETSIZE; a++) { readEntry(&b->entry[a], &slot[a]); }
+	for (int a = 0; a < BUCKETSIZE; a++)
+	{
+		if ((slot[a].key ^ entryData(&slot[a])) == key)
+		{
+			e = a;
+			// Keep a deeper result from this search, unless the new one is exact.
+			if ((slot[a].age == hash->age) && (slot[a].depth > depth) && (bound != BOUND_EXACT)) { return; }
+			break;
+		}
+	}
+
+	if (e < 0)
+	{
+		e = 0;
+		for (int a = 1; a < DEEPSLOTS; a++)
+		{
+			// An entry from an old search goes first, then the shallowest.
+			bool old = (slot[a].age != hash->age);
+			bool eOld = (slot[e].age != hash->age);
+
+			if ((old && !eOld) || ((old == eOld) && (slot[a].depth < slot[e].depth))) { e = a; }
+		}
+		if ((slot[e].age == hash->age) && (slot[e].depth > depth) && (slot[e].bound != BOUND_NONE)) { e = BUCKETSIZE - 1; }
+	}
+
+	hashEntry_t entry;
+
+	entry.score = (int16_t)score;
+	entry.depth = (uint8_t)depth;
+	entry.move = (uint8_t)move;
+	entry.bound = (uint8_t)bound;
+	entry.age = hash->age;
+	entry.spare = 0;
+	entry.key = key ^ entryData(&entry);
+	copyEntry(&b->entry[e], &entry);
+}
@@ -0,0 +1,85 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Hash header.
+//*
+//* Transposition table for the search. The same position is often reached by different orders of moves, and each
+//* depth of iterative deepening goes over the positions of the last one again, so the results are kept by Zobrist key.
+//*
+//* The table is made of buckets the size of a cache line, so looking up a position reads only one line of memory.
+//* The size is set when the table is made, so the Wii U can use a small table and the host tools a very large one.
+//* All of the search threads share the one table, without locking.
+//*
+//************************************************************************************************************************
+#pragma once
+
+#include <stddef.h>					// For size_t.
+
+#include "Bitboard.h"				// Bitboard board representation.
+
+// Kind of score held in an entry.
+enum bound_e { BOUND_NONE, BOUND_UPPER, BOUND_LOWER, BOUND_EXACT };	// Empty, score at most, score at least, exact score.
+
+// One stored search result, 16 bytes.
+typedef struct hashEntry hashEntry_t;
+
+struct hashEntry
+{
+	uint64_t key;		// Zobrist key of the position, stored XORed with the rest of the entry (see Hash.c).
+	int16_t score;		// Score found for the player to move.
+	uint8_t depth;		// Depth it was searched to.
+	uint8_t move;		// Best move found (or the move that cut off the search), PASS if none.
+	uint8_t bound;		// Kind of score, from bound_e.
+	uint8_t age;		// Search the entry was stored in, so entries from old searches are replaced first.
+	uint16_t spare;		// Not used, keeps the entry to 16 bytes.
+};
+
+#define BUCKETSIZE 4	// Entries in a bucket, 64 bytes (one cache line).
+#define DEEPSLOTS  3	// The first entries keep the deepest results, the last is always replaced.
+
+// Entries for positions with the same low bits of the key.
+typedef struct hashBucket hashBucket_t;
+
+struct hashBucket
+{
+	hashEntry_t entry[BUCKETSIZE];
+};
+
+// The table, which is empty (no buckets) until it is given a size.
+typedef struct hashTable hashTable_t;
+
+struct hashTable
+{
+	hashBucket_t* buckets;	// Buckets, aligned to the start of a cache line.
+	void* memory;			// Memory allocated for the buckets, to be freed.
+	uint64_t mask;			// Number of buckets less one (a power of two less one).
+	uint8_t age;			// Count of searches, stored with each entry.
+};
+
+void initHash(hashTable_t* hash);						// Start with an empty table with no memory.
+
+bool resizeHash(hashTable_t* hash, size_t megabytes);	// Make the table use up to the number of megabytes (rounded down to a power of
+														// two number of buckets), returns false if the memory is not available.
+
+void freeHash(hashTable_t* hash);						// Free the memory used by the table.
+
+void clearHash(hashTable_t* hash);						// Empty all of the entries, for a new game.
+
+void newSearchHash(hashTable_t* hash);					// Start a new search, so the entries already stored become old.
+
+bool probeHash(const hashTable_t* hash, uint64_t key, hashEntry_t* entry);	// Copy the entry for a position, false if it is not stored.
+
+void storeHash(hashTable_t* hash, uint64_t key, int depth, int score, int bound, int move);	// Store a search result.
+
+// Start reading the bucket for a position into the cache, so it is there by the time it is looked up.
+static inline void prefetchHash(const hashTable_t* hash, uint64_t key)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	if (hash->buckets != NULL) { __builtin_prefetch(&hash->buckets[key & hash->mask]); }
+#else
+	(void)hash;
+	(void)key;
+#endif
+}
@@ -0,0 +1,76 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Playout
+//*
+//* Random moves and random playouts, working directly on the bitboards so that no table is scanned.
+//*
+//************************************************************************************************************************
+#include "Playout.h"		// Random numbers and playouts.
+
+// The four corner squares, and the edge squares that are not corners.
+#define CORNERS (SQUAREBIT(SQUARE(1, 1)) | SQUAREBIT(SQUARE(BOARDSIZE, 1)) | SQUAREBIT(SQUARE(1, BOARDSIZE)) | SQUAREBIT(SQUARE(BOARDSIZE, BOARDSIZE)))
+#define EDGES   ((COLUMN1 | COLUMNN | (BOARDMASK >> (NSQUARES - BOARDSIZE)) | (BOARDMASK << (NSQUARES - BOARDSIZE))) & BOARDMASK & ~CORNERS)
+
+// Start the generator. The seed is mixed (splitmix64) so that similar seeds give unrelated sequences and 0 is never the state.
+void seedRandom(rng_t* rng, uint64_t seed)
+{
+	uint64_t z = seed + 0x9e3779b97f4a7c15ULL;
+
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	z = z ^ (z >> 31);
+	rng->state = (z != 0) ? z : 0x9e3779b97f4a7c15ULL;
+}
+
+// Pick the n-th move, counting from the lowest square, by clearing the lower moves.
+int randomMove(bitboard_t moves, rng_t* rng)
+{
+	for (unsigned int n = randomBelow(rng, bitCount(moves)); n > 0; n--) { moves &= moves - 1; }
+	return firstSquare(moves);
+}
+
+// Like the dummy player in optimisation, corners are always taken and edges are favoured, otherwise the move is random.
+int weightedRandomMove(bitboard_t moves, rng_t* rng)
+{
+	if (moves & CORNERS) { return randomMove(moves & CORNERS, rng); }
+	if ((moves & EDGES) && (randomBelow(rng, 4) != 0)) { return randomMove(moves & EDGES, rng); }	// Edges three times out of four.
+	return randomMove(moves, rng);
+}
+
+// Play the game out with random moves. Only the pieces are needed, so the moves are played on a copy of the two bitboards
+// without keeping the Zobrist keys up to date, which would only slow the playout down.
+int playout(const position_t* pos, rng_t* rng, bool weighted)
+{
+	bitboard_t own = pos->own;
+	bitboard_t opp = pos->opp;
+	bitboard_t t;
+	int side = 1;	// 1 while the player who started is to move, -1 for the opponent.
+
+	for (;;)
+	{
+		bitboard_t moves = getMoves(own, opp);
+
+		if (moves != 0)
+		{
+			int sq = weighted ? weightedRandomMove(moves, rng) : randomMove(moves, rng);
+			bitboard_t flips = getFlips(sq, own, opp);
+
+			own |= flips | SQUAREBIT(sq);
+			opp &= ~flips;
+		}
+		else if (getMoves(opp, own) == 0)
+		{
+			break;	// With no moves for either player the game is over, otherwise the player misses a turn.
+		}
+
+		// Hand the turn to the opponent.
+		t = own;
+		own = opp;
+		opp = t;
+		side = -side;
+	}
+	return side * (bitCount(own) - bitCount(opp));
+}
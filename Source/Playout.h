@@ -0,0 +1,47 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Playout header.
+//*
+//* Random number generator and random playouts (playing a game to the end with random moves), for the dummy player used
+//* in optimisation and for Monte Carlo style testing. The moves are picked straight from the bitboard of valid moves.
+//*
+//************************************************************************************************************************
+#pragma once
+
+#include "Bitboard.h"				// Bitboard board representation.
+
+// Random number generator (xorshift64*). Each engine or thread has its own, so there is no shared state as with rand(),
+// and a run can be repeated by using the same seed.
+typedef struct rng rng_t;
+
+struct rng
+{
+	uint64_t state;		// Must never be 0.
+};
+
+void seedRandom(rng_t* rng, uint64_t seed);				// Start the generator from a seed, any value (including 0) can be used.
+
+// Get the next random number, 0 to 0xffffffff.
+static inline uint32_t nextRandom(rng_t* rng)
+{
+	rng->state ^= rng->state >> 12;
+	rng->state ^= rng->state << 25;
+	rng->state ^= rng->state >> 27;
+	return (uint32_t)((rng->state * 0x2545f4914f6cdd1dULL) >> 32);
+}
+
+// Get a random number from 0 to n - 1. Multiplying rather than taking the remainder avoids a divide.
+static inline unsigned int randomBelow(rng_t* rng, unsigned int n)
+{
+	return (unsigned int)(((uint64_t)nextRandom(rng) * n) >> 32);
+}
+
+int randomMove(bitboard_t moves, rng_t* rng);				// Pick one of the moves, each as likely as any other. moves must not be empty.
+
+int weightedRandomMove(bitboard_t moves, rng_t* rng);		// Pick a move, always taking a corner and usually an edge if there is one.
+
+int playout(const position_t* pos, rng_t* rng, bool weighted);	// Play random moves from the position until the game ends. Returns the pieces
+																// of the player to move less the opponent's at the end.
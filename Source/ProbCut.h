@@ -0,0 +1,73 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* ProbCut header.
+//*
+//* GENERATED BY Tools/Calibrate.c, DO NOT EDIT. Multi-ProbCut lines for each stage and depth of the 8x8 game,
+//* fitted to 2000 positions from self-play games.
+//*
+//************************************************************************************************************************
+#pragma once
+
+#include "Search.h"		// Multi-ProbCut types.
+
+#define MPCMAXDEPTH 10	// Deepest search with a fit.
+
+// Shallow depth, slope (times 1024), offset and sigma for each stage (from the end of the game) and depth.
+static const probCut_t probCut[MPCSTAGES][MPCMAXDEPTH + 1] =
+{
+	{
+		{  0,    0,    0,    0 },	// Depth 0
+		{  0,    0,    0,    0 },	// Depth 1
+		{  1, 1037,   55,  145 },	// Depth 2, 412 positions
+		{  1, 1113,   -3,  452 },	// Depth 3, 412 positions
+		{  2, 1218,   13,  696 },	// Depth 4, 412 positions
+		{  2, 1419,   47,  912 },	// Depth 5, 412 positions
+		{  3, 1390,  126,  940 },	// Depth 6, 412 positions
+		{  3, 1515,  144, 1060 },	// Depth 7, 412 positions
+		{  4, 1379,   66, 1095 },	// Depth 8, 412 positions
+		{  4, 1466,   62, 1197 },	// Depth 9, 412 positions
+		{  5, 1314,   61, 1195 },	// Depth 10, 412 positions
+	},
+	{
+		{  0,    0,    0,    0 },	// Depth 0
+		{  0,    0,    0,    0 },	// Depth 1
+		{  1, 1038,   67,  128 },	// Depth 2, 508 positions
+		{  1, 1064,   31,  149 },	// Depth 3, 508 positions
+		{  2, 1062,    5,  141 },	// Depth 4, 508 positions
+		{  2, 1115,  -37,  215 },	// Depth 5, 508 positions
+		{  3, 1112,   56,  263 },	// Depth 6, 508 positions
+		{  3, 1158,    8,  313 },	// Depth 7, 508 positions
+		{  4, 1182,    3,  342 },	// Depth 8, 508 positions
+		{  4, 1210,  -40,  356 },	// Depth 9, 508 positions
+		{  5, 1213,   34,  385 },	// Depth 10, 508 positions
+	},
+	{
+		{  0,    0,    0,    0 },	// Depth 0
+		{  0,    0,    0,    0 },	// Depth 1
+		{  1, 1020,   25,  112 },	// Depth 2, 570 positions
+		{  1, 1048,   11,  123 },	// Depth 3, 570 positions
+		{  2, 1072,    1,  102 },	// Depth 4, 570 positions
+		{  2, 1089,  -15,  137 },	// Depth 5, 570 positions
+		{  3, 1094,   21,  124 },	// Depth 6, 570 positions
+		{  3, 1119,    1,  129 },	// Depth 7, 570 positions
+		{  4, 1117,    8,  128 },	// Depth 8, 570 positions
+		{  4, 1135,  -15,  146 },	// Depth 9, 570 positions
+		{  5, 1135,   30,  128 },	// Depth 10, 570 positions
+	},
+	{
+		{  0,    0,    0,    0 },	// Depth 0
+		{  0,    0,    0,    0 },	// Depth 1
+		{  1,  830,   -8,  100 },	// Depth 2, 510 positions
+		{  1,  792,   59,   95 },	// Depth 3, 510 positions
+		{  2,  854,   -1,   83 },	// Depth 4, 510 positions
+		{  2,  766,   73,  102 },	// Depth 5, 510 positions
+		{  3,  850,  -54,  103 },	// Depth 6, 510 positions
+		{  3,  847,    8,  100 },	// Depth 7, 510 positions
+		{  4,  913,   12,   93 },	// Depth 8, 510 positions
+		{  4,  903,   71,   94 },	// Depth 9, 510 positions
+		{  5,  940,  -53,   87 },	// Depth 10, 510 positions
+	},
+};
@@ -0,0 +1,619 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Search
+//*
+//* Negamax alpha-beta search. Each position is scored for the player to move, so the score for the opponent is just
+//* the negative, and one function searches for both players. Lines of moves that cannot change the result (because the
+//* opponent already has a better choice earlier on) are cut off without being searched.
+//*
+//* The search is run one move deeper each time (iterative deepening), so when the time runs out there is always the
+//* result of the last full depth to use, and the best move from each depth is searched first at the next.
+//* Principal variation search and aspiration windows narrow the window each position is searched with, so that more of
+//* the search is cut off, and each can be switched off to compare against plain alpha-beta. MTD(f) goes further, and
+//* finds the score of each depth with only null window searches, relying on the hash table to keep the work of each one.
+//*
+//* With more than one thread the search is run in parallel by Lazy SMP. Helper threads run the same search on the same
+//* position, and as they share the hash table each one mostly finds the results of the others there and goes on to
+//* different parts of the tree. The result is taken from the main thread, when its last depth finishes.
+//*
+//************************************************************************************************************************
+#include "Search.h"			// Search API.
+#include "Stable.h"			// Stable pieces, for the stability cutoff.
+#include "Endgame.h"		// Exact solver for the end of the game.
+#include "Thread.h"			// Helper threads for the parallel search.
+
+#include <stdlib.h>			// For malloc and free.
+
+#if BOARDSIZE == 8
+#include "ProbCut.h"		// Multi-ProbCut lines, only fitted for the 8x8 board.
+#else
+#define MPCMAXDEPTH 0		// No Multi-ProbCut for the other board sizes.
+static const probCut_t probCut[MPCSTAGES][1] = { { { 0, 0, 0, 0 } } };
+#endif
+
+#ifdef __WIIU__
+#include <coreinit/time.h>	// For the system time.
+#else
+#include <time.h>			// For timespec_get.
+#endif
+
+// Weightings for the static evaluation, in hundredths of a disc.
+const evalWeights_t defaultEval =
+{
+	 400,	// corner
+	-200,	// xSquare
+	 -50,	// cSquare
+	  60,	// mobility
+	  20,	// potential
+};
+
+// The four corners, and the squares diagonally next to them.
+#define CORNERS  (SQUAREBIT(SQUARE(1, 1)) | SQUAREBIT(SQUARE(BOARDSIZE, 1)) | SQUAREBIT(SQUARE(1, BOARDSIZE)) | SQUAREBIT(SQUARE(BOARDSIZE, BOARDSIZE)))
+#define XSQUARES (SQUAREBIT(SQUARE(2, 2)) | SQUAREBIT(SQUARE(BOARDSIZE - 1, 2)) | SQUAREBIT(SQUARE(2, BOARDSIZE - 1)) | SQUAREBIT(SQUARE(BOARDSIZE - 1, BOARDSIZE - 1)))
+
+#define TIMECHECK 1023		// The time is checked each time this many more positions have been searched.
+#define ASPIRATION 50		// Half the width of the search window around the score from the last depth (half a disc).
+#define MPCMINDEPTH 3		// Shallowest search that Multi-ProbCut is tried on.
+#define MPCTHRESHOLD 15		// How far outside the window the predicted score must be to cut off, in tenths of sigma.
+
+// Move ordering. Moves are given an ordering score and searched highest first, as the sooner the best move is searched
+// the more of the other moves are cut off.
+#define HASHORDER     (1 << 20)	// The best move from the hash table goes first.
+#define KILLERORDER    300		// Bonus for the last move to cut off the search at the same ply (less for the one before).
+#define CORNERORDER    500		// Bonus for taking a corner.
+#define XSQUAREORDER  -500		// Penalty for a square diagonally next to an empty corner.
+#define MOBILITYORDER  -40		// Penalty for each move the opponent has after the move (fewest replies first).
+#define FASTESTDEPTH    3		// Depth from which the opponent replies are counted, nearer the leaves it costs too much.
+#define HISTORYMAX (1 << 16)	// The history scores are halved when one reaches this.
+#define HISTORYSHIFT    9		// History scores are divided down by this shift, to at most 128.
+
+// Working data for a search.
+typedef struct searcher searcher_t;
+
+struct searcher
+{
+	moveStack_t stack;			// Position being searched, with the moves made to get there.
+	hashTable_t* hash;			// Results kept from earlier in the search, and from earlier searches.
+	int killers[MAXPLY][2];		// The last two moves to cut off the search at each ply.
+	int history[NSQUARES];		// Score for each square, increased each time a move there cuts off the search.
+	unsigned long long nodes;	// Number of positions searched.
+	unsigned long long cutoffs;			// Number of positions where the search was cut off.
+	unsigned long long firstCutoffs;	// Number of those where the first move searched was enough to cut off.
+	bool pvs;					// Search the moves after the first with a null window (principal variation search).
+	bool probcut;				// Use Multi-ProbCut.
+	const evalWeights_t* eval;	// Weightings for the evaluation.
+	long long stopTime;			// Time to stop the search in milliseconds, or 0 for no time limit.
+	bool* stop;					// Set by the main thread to stop the helper threads, shared by all of the threads.
+	bool stopped;				// Set when the time runs out or the thread is stopped, the scores from then on are not used.
+};
+
+// Get the time in milliseconds, from any starting point.
+long long getMillis(void)
+{
+#ifdef __WIIU__
+	return (long long)OSTicksToMilliseconds(OSGetTime());
+#else
+	struct timespec ts;
+
+	timespec_get(&ts, TIME_UTC);
+	return ((long long)ts.tv_sec * 1000) + (ts.tv_nsec / 1000000);
+#endif
+}
+
+// Score a finished game from the pieces each player holds.
+static int finalScore(const position_t* pos)
+{
+	return (bitCount(pos->own) - bitCount(pos->opp)) * DISCSCORE;
+}
+
+// Evaluate the position for the player to move, without looking at any moves ahead.
+// Corners are worth most as they can never be flipped, then having more moves than the opponent (mobility) and
+// more empty squares next to opponent pieces (potential moves). Pieces that give away an empty corner count against.
+int evaluate(const position_t* pos, const evalWeights_t* w)
+{
+	bitboard_t own = pos->own;
+	bitboard_t opp = pos->opp;
+	bitboard_t nearCorner = getNeighbours(CORNERS & ~(own | opp)) & ~CORNERS;	// Squares next to an empty corner.
+	int score;
+
+	score  = w->corner * (bitCount(own & CORNERS) - bitCount(opp & CORNERS));
+	score += w->xSquare * (bitCount(own & nearCorner & XSQUARES) - bitCount(opp & nearCorner & XSQUARES));
+	score += w->cSquare * (bitCount(own & nearCorner & ~XSQUARES) - bitCount(opp & nearCorner & ~XSQUARES));
+	score += w->mobility * (getMobility(own, opp) - getMobility(opp, own));
+	score += w->potential * (getPotentialMobility(own, opp) - getPotentialMobility(opp, own));
+
+	// Keep the estimate inside the range of real scores.
+	if (score >= MAXSCORE)  { score = MAXSCORE - 1; }
+	if (score <= -MAXSCORE) { score = 1 - MAXSCORE; }
+	return score;
+}
+
+// Give each of the moves an ordering score. The hash move goes first, then the rest are ordered by how many replies
+// they leave the opponent (fastest first), whether they take a corner or give one away, and how often they have cut off
+// the search before (killers at this ply and history anywhere). Returns the number of moves.
+static int orderMoves(const searcher_t* s, bitboard_t moves, int hashMove, int depth, int* list, int* order)
+{
+	const position_t* pos = &s->stack.pos;
+	const int* killers = s->killers[s->stack.ply];
+	bitboard_t empty = ~(pos->own | pos->opp);
+	bitboard_t xsquares = getNeighbours(CORNERS & empty) & XSQUARES;
+	int n = 0;
+
+	for (; moves; moves &= moves - 1)
+	{
+		int sq = firstSquare(moves);
+		int score = s->history[sq] >> HISTORYSHIFT;
+
+		if (sq == hashMove) { score += HASHORDER; }
+		if (sq == killers[0]) { score += KILLERORDER; }
+		else if (sq == killers[1]) { score += KILLERORDER / 2; }
+		if (SQUAREBIT(sq) & CORNERS) { score += CORNERORDER; }
+		if (SQUAREBIT(sq) & xsquares) { score += XSQUAREORDER; }
+		if (depth >= FASTESTDEPTH)
+		{
+			bitboard_t flips = getFlips(sq, pos->own, pos->opp);
+			score += MOBILITYORDER * getMobility(pos->opp & ~flips, pos->own | flips | SQUAREBIT(sq));
+		}
+		list[n] = sq;
+		order[n] = score;
+		n++;
+	}
+	return n;
+}
+
+// Take the move with the highest ordering score out of those not yet searched (from a onwards), and swap it to position a.
+// Only the moves that get searched are sorted, which saves time when the first move cuts off the search.
+static int nextMove(int* list, int* order, int n, int a)
+{
+	int b = a;
+
+	for (int c = a + 1; c < n; c++)
+	{
+		if (order[c] > order[b]) { b = c; }
+	}
+	int sq = list[b];
+	int score = order[b];
+
+	list[b] = list[a];
+	order[b] = order[a];
+	list[a] = sq;
+	order[a] = score;
+	return sq;
+}
+
+// A move cut off the search. It becomes the killer move for the ply, and its history score goes up by more the deeper
+// the search was (as that saved more work).
+static void updateCutoff(searcher_t* s, int sq, int depth, int searched)
+{
+	int* killers = s->killers[s->stack.ply];
+
+	s->cutoffs++;
+	if (searched == 1) { s->firstCutoffs++; }
+
+	if (killers[0] != sq)
+	{
+		killers[1] = killers[0];
+		killers[0] = sq;
+	}
+
+	s->history[sq] += depth * depth;
+	if (s->history[sq] >= HISTORYMAX)
+	{
+		for (int a = 0; a < NSQUARES; a++) { s->history[a] /= 2; }
+	}
+}
+
+static int negamax(searcher_t* s, int depth, int alpha, int beta);
+
+// Divide rounding down, for negative numbers too.
+static int divideDown(int x, int y)
+{
+	return (x >= 0) ? (x / y) : -((y - 1 - x) / y);
+}
+
+// Multi-ProbCut. A shallow search predicts the score of the deep search. If the predicted score is far enough above beta
+// (or below alpha) for the deep score to be outside the window almost certainly, the position is cut off without the
+// deep search. Returns true with the score to use if the position is cut off.
+// The shallow search only has to find out which side of a bound its score is, so it is a null window search.
+static bool probCutOff(searcher_t* s, int depth, int alpha, int beta, int* score)
+{
+	if ((depth < MPCMINDEPTH) || (depth > MPCMAXDEPTH)) { return false; }
+
+	int empties = NSQUARES - bitCount(s->stack.pos.own | s->stack.pos.opp);
+	const probCut_t* p = &probCut[probCutStage(empties)][depth];
+	int margin = (MPCTHRESHOLD * p->sigma) / 10;
+
+	if ((p->shallow == 0) || (p->a <= 0)) { return false; }
+
+	// The shallow score that predicts a deep score of at least beta + margin.
+	if (beta < MAXSCORE)
+	{
+		int bound = -divideDown(-(beta + margin - p->b) * 1024, p->a);	// Rounded up.
+
+		if ((bound < MAXSCORE) && (negamax(s, p->shallow, bound - 1, bound) >= bound))
+		{
+			*score = beta;
+			return true;
+		}
+	}
+
+	// The shallow score that predicts a deep score of at most alpha - margin.
+	if (alpha > -MAXSCORE)
+	{
+		int bound = divideDown((alpha - margin - p->b) * 1024, p->a);
+
+		if ((bound > -MAXSCORE) && (negamax(s, p->shallow, bound, bound + 1) <= bound))
+		{
+			*score = alpha;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Search the move just made, returning its score for the player who made it. With principal variation search only the
+// first move gets the full window. The moves after it are expected to be worse, so they are searched with a null window
+// (alpha to alpha + 1), which only finds out whether they are better than alpha but cuts off far more of the search.
+// If one is better it is searched again with the full window to get its score.
+static int searchMove(searcher_t* s, int depth, int alpha, int beta, bool first)
+{
+	if (first || !s->pvs) { return -negamax(s, depth, -beta, -alpha); }
+
+	int score = -negamax(s, depth, -alpha - 1, -alpha);
+
+	if ((score > alpha) && (score < beta)) { score = -negamax(s, depth, -beta, -alpha); }
+	return score;
+}
+
+// Search the position on the top of the stack to the depth, returning its score for the player to move.
+// Only scores between alpha and beta matter: a score at or below alpha is no better than a move already found,
+// and a score at or above beta is more than the opponent would allow, so the search can stop as soon as it finds one.
+static int negamax(searcher_t* s, int depth, int alpha, int beta)
+{
+	position_t* pos = &s->stack.pos;
+	bitboard_t moves = getMoves(pos->own, pos->opp);
+	int best = -INFSCORE;
+	int score;
+
+	s->nodes++;
+	if ((s->nodes & TIMECHECK) == 0)
+	{
+		if ((s->stopTime != 0) && (getMillis() >= s->stopTime)) { s->stopped = true; }
+		if (readFlag(s->stop)) { s->stopped = true; }
+	}
+	if (s->stopped) { return 0; }
+
+	if (moves == 0)
+	{
+		// With no moves for either player the game is over, otherwise the player misses a turn.
+		// Missing a turn does not use up any depth, as it does not take the game any further on.
+		if (getMoves(pos->opp, pos->own) == 0) { return finalScore(pos); }
+		makeMove(&s->stack, PASS);
+		score = -negamax(s, depth, -beta, -alpha);
+		unmakeMove(&s->stack);
+		return score;
+	}
+
+	if (depth == 0) { return evaluate(pos, s->eval); }
+
+	// If the position has been searched deep enough before, the score may be all that is needed. Otherwise the best
+	// move found last time is searched first, as it is likely to be the best again.
+	hashEntry_t e;
+	int hashMove = PASS;
+	int oldAlpha = alpha;
+	int bestMove = PASS;
+
+	if (probeHash(s->hash, pos->key, &e))
+	{
+		hashMove = e.move;
+		if (e.depth >= depth)
+		{
+			if (e.bound == BOUND_EXACT) { return e.score; }
+			if ((e.bound == BOUND_LOWER) && (e.score >= beta)) { return e.score; }
+			if ((e.bound == BOUND_UPPER) && (e.score <= alpha)) { return e.score; }
+		}
+	}
+
+	// Stability cutoff. The opponent's stable pieces can never be taken, so they limit the final score the player to move
+	// can get. If even that is no better than alpha, there is no need to search. This bounds the final score, so it is
+	// only used when the search reaches the end of the game (passes use up no depth), where the scores compared with it
+	// are final scores too rather than evaluations. The stable pieces are only worked out when alpha is high enough for
+	// this to be possible.
+	int empties = NSQUARES - bitCount(pos->own | pos->opp);
+	if ((depth >= empties) && (alpha >= (NSQUARES - (2 * bitCount(pos->opp))) * DISCSCORE)
+		&& (alpha >= (2 * empties - 2) * DISCSCORE))
+	{
+		int maxScore = (NSQUARES - (2 * bitCount(getStable(pos->opp, pos->own)))) * DISCSCORE;
+
+		if (maxScore <= alpha) { return maxScore; }
+	}
+
+	if (s->probcut && probCutOff(s, depth, alpha, beta, &score)) { return score; }
+
+	int list[NSQUARES];		// Moves, in the order they are searched.
+	int order[NSQUARES];	// Ordering score of each move.
+	int n = orderMoves(s, moves, hashMove, depth, list, order);
+
+	for (int a = 0; a < n; a++)
+	{
+		int sq = nextMove(list, order, n, a);
+
+		makeMove(&s->stack, sq);
+		prefetchHash(s->hash, s->stack.pos.key);	// Start reading the entry for the new position while its moves are worked out.
+		score = searchMove(s, depth - 1, alpha, beta, a == 0);
+		unmakeMove(&s->stack);
+
+		if (score > best)
+		{
+			best = score;
+			bestMove = sq;
+			if (score > alpha) { alpha = score; }
+			if (alpha >= beta)
+			{
+				// The opponent will not allow this line, so there is no need to look at the other moves.
+				if (!s->stopped) { updateCutoff(s, sq, depth, a + 1); }
+				break;
+			}
+		}
+	}
+
+	// Keep the result. If no move beat alpha the score is only known to be at most alpha, and if the search was cut off the
+	// score is only known to be at least beta.
+	if (!s->stopped)
+	{
+		int bound = (best <= oldAlpha) ? BOUND_UPPER : ((best >= beta) ? BOUND_LOWER : BOUND_EXACT);
+
+		storeHash(s->hash, pos->key, depth, best, bound, bestMove);
+	}
+	return best;
+}
+
+// Search each of the moves at the start to the depth, within the window alpha to beta. If a move scores above alpha, the
+// best move is moved to the front of the list, ready to be searched first at the next depth. On equal scores the move
+// nearer the front is kept. Returns the best score, which is only a bound if it is outside the window.
+static int searchRoot(searcher_t* s, int* moves, int n, int depth, int alpha, int beta)
+{
+	int best = -INFSCORE;
+	int bestN = 0;
+
+	for (int a = 0; a < n; a++)
+	{
+		makeMove(&s->stack, moves[a]);
+		prefetchHash(s->hash, s->stack.pos.key);
+		int score = searchMove(s, depth - 1, alpha, beta, a == 0);
+		unmakeMove(&s->stack);
+
+		if (s->stopped) { return best; }
+		if (score > best)
+		{
+			best = score;
+			if (score > alpha)
+			{
+				alpha = score;
+				bestN = a;
+			}
+			if (alpha >= beta) { break; }
+		}
+	}
+
+	// Move the best move to the front, keeping the others in the same order.
+	int move = moves[bestN];
+	for (int a = bestN; a > 0; a--) { moves[a] = moves[a - 1]; }
+	moves[0] = move;
+	return best;
+}
+
+// MTD(f). Each null window search shows whether the score is above or below a guess, and the guess is moved to that side
+// until the score is pinned down. The first guess is the score from the last depth. Returns the score.
+static int searchMTDF(searcher_t* s, int* moves, int n, int depth, int guess)
+{
+	int lower = -INFSCORE;
+	int upper = INFSCORE;
+	int score = guess;
+
+	while (lower < upper)
+	{
+		int beta = (score == lower) ? score + 1 : score;
+
+		score = searchRoot(s, moves, n, depth, beta - 1, beta);
+		if (s->stopped) { break; }
+		if (score < beta) { upper = score; }
+		else { lower = score; }
+	}
+	return score;
+}
+
+// Search to one depth with the search methods in the limits, starting from the score of the depth before.
+// With aspiration windows the search starts with a narrow window around that score, which cuts off more of the search.
+// If the score turns out to be outside the window, that side is opened up and it is searched again.
+static int searchDepth(searcher_t* s, int* moves, int n, int depth, int last, const searchLimits_t* limits)
+{
+	int alpha = -INFSCORE;
+	int beta = INFSCORE;
+	int score;
+
+	if (limits->mtdf) { return searchMTDF(s, moves, n, depth, last); }
+
+	if (limits->aspiration && (depth > 1))
+	{
+		alpha = (last - ASPIRATION > -INFSCORE) ? last - ASPIRATION : -INFSCORE;
+		beta = (last + ASPIRATION < INFSCORE) ? last + ASPIRATION : INFSCORE;
+	}
+	for (;;)
+	{
+		score = searchRoot(s, moves, n, depth, alpha, beta);
+		if (s->stopped) { break; }
+		if (score <= alpha)     { alpha = -INFSCORE; }
+		else if (score >= beta) { beta = INFSCORE; }
+		else { break; }
+	}
+	return score;
+}
+
+// A helper thread for the parallel search, with its own copy of the moves and its own move ordering.
+typedef struct helper helper_t;
+
+struct helper
+{
+	searcher_t s;					// Working data for the thread.
+	const searchLimits_t* limits;	// Search methods, the same as the main thread.
+	int moves[NSQUARES];			// Moves to search, in the order to search them.
+	int moveN;
+	int first;						// Depth to start at.
+	int last;						// Deepest depth to search.
+	thread_t thread;
+};
+
+// Run a helper thread. It deepens in the same way as the main thread until it is stopped. Every other helper starts one
+// depth ahead (staggered), so that the threads are spread over two depths rather than all searching the same one.
+static void helperSearch(void* arg)
+{
+	helper_t* h = (helper_t*)arg;
+	int score = 0;
+
+	for (int depth = h->first; (depth <= h->last) && !h->s.stopped; depth++)
+	{
+		score = searchDepth(&h->s, h->moves, h->moveN, depth, score, h->limits);
+	}
+}
+
+// Search for the best move, one move deeper at a time until the depth or time limit is reached.
+void searchPosition(const position_t* pos, const int* order, int n, const searchLimits_t* limits, hashTable_t* hash, searchResult_t* result)
+{
+	searcher_t s;
+	int moves[NSQUARES];		// Moves to search, in the order to search them.
+	int moveN = 0;
+	bitboard_t valid = getMoves(pos->own, pos->opp);
+	bitboard_t left = valid;
+	int empties = NSQUARES - bitCount(pos->own | pos->opp);
+	long long startTime = getMillis();
+	bool stop = false;			// Stops the helper threads.
+
+	startStack(&s.stack, pos);
+	s.hash = hash;
+	s.nodes = 0;
+	s.cutoffs = 0;
+	s.firstCutoffs = 0;
+	for (int a = 0; a < MAXPLY; a++) { s.killers[a][0] = PASS; s.killers[a][1] = PASS; }
+	for (int a = 0; a < NSQUARES; a++) { s.history[a] = 0; }
+	s.pvs = limits->pvs;
+	s.probcut = limits->probcut;
+	s.eval = (limits->eval != NULL) ? limits->eval : &defaultEval;
+	s.stopTime = (limits->millis > 0) ? startTime + limits->millis : 0;
+	s.stop = &stop;
+	s.stopped = false;
+
+	result->move = PASS;
+	result->score = 0;
+	result->depth = 0;
+	result->mode = limits->mtdf ? MODE_MTDF : MODE_SEARCH;
+	result->nodes = 0;
+	result->cutoffs = 0;
+	result->firstCutoffs = 0;
+
+	// Put the moves in the order given first, then any others.
+	for (int a = 0; a < n; a++)
+	{
+		if (left & SQUAREBIT(order[a]))
+		{
+			moves[moveN++] = order[a];
+			left &= ~SQUAREBIT(order[a]);
+		}
+	}
+	for (; left; left &= left - 1) { moves[moveN++] = firstSquare(left); }
+
+	if (moveN == 0) { return; }	// The player has to miss a turn.
+	result->move = moves[0];
+	newSearchHash(hash);
+	initStable();
+
+	int threads = (limits->threads > 0) ? limits->threads : getCores();
+
+	if (threads > MAXTHREADS) { threads = MAXTHREADS; }
+
+	// Near the end of the game, solve it exactly instead, within half the time. A little earlier (or if the exact solve runs
+	// out of time) a win or draw can be proved in half the time left, and the move that gets it played. Otherwise the
+	// search goes on as normal, with the work of the solves kept in the hash table.
+	if (empties <= limits->solve)
+	{
+		long long solveStop = (limits->millis > 0) ? startTime + (limits->millis / 2) : 0;
+
+		if (solveEndgame(pos, moves, moveN, MODE_EXACT, limits->mtdf, threads, solveStop, s.eval, hash, result)) { return; }
+		s.nodes += result->nodes;
+		s.cutoffs += result->cutoffs;
+		s.firstCutoffs += result->firstCutoffs;
+	}
+	if (empties <= limits->wld)
+	{
+		long long now = getMillis();
+		long long wldStop = (limits->millis > 0) ? now + ((startTime + limits->millis - now) / 2) : 0;
+
+		if (solveEndgame(pos, moves, moveN, MODE_WLD, false, threads, wldStop, s.eval, hash, result) && (result->score >= 0)) { return; }
+		s.nodes += result->nodes;
+		s.cutoffs += result->cutoffs;
+		s.firstCutoffs += result->firstCutoffs;
+	}
+	if ((empties <= limits->solve) || (empties <= limits->wld))
+	{
+		result->move = moves[0];
+		result->score = 0;
+		result->depth = 0;
+		result->mode = limits->mtdf ? MODE_MTDF : MODE_SEARCH;
+	}
+
+	// Start the helper threads, each with a copy of the main thread's working data.
+	helper_t* helpers = NULL;
+	int helperN = 0;
+
+	if (threads > 1) { helpers = (helper_t*)malloc(sizeof(helper_t) * (threads - 1)); }
+	for (int a = 0; (helpers != NULL) && (a < threads - 1); a++)
+	{
+		helper_t* h = &helpers[helperN];
+
+		h->s = s;
+		h->s.nodes = 0;
+		h->s.cutoffs = 0;
+		h->s.firstCutoffs = 0;
+		h->s.stopTime = 0;
+		h->limits = limits;
+		for (int b = 0; b < moveN; b++) { h->moves[b] = moves[b]; }
+		h->moveN = moveN;
+		h->first = 1 + ((a + 1) & 1);
+		h->last = (limits->depth < empties) ? limits->depth : empties;
+		if (startThread(&h->thread, a + 1, helperSearch, h)) { helperN++; }
+	}
+
+	for (int depth = 1; depth <= limits->depth; depth++)
+	{
+		int score = searchDepth(&s, moves, moveN, depth, result->score, limits);
+
+		if (s.stopped) { break; }	// The time ran out, so the last full depth is used.
+		result->move = moves[0];
+		result->score = score;
+		result->depth = depth;
+
+		// Once the search reaches the end of the game there is nothing more to find.
+		if (depth >= empties) { break; }
+
+		// The next depth takes several times as long, so do not start it if it will not finish in time.
+		if ((s.stopTime != 0) && (getMillis() - startTime >= limits->millis / 2)) { break; }
+	}
+
+	// Stop the helpers, and count their work with the main thread's.
+	setFlag(&stop);
+	for (int a = 0; a < helperN; a++)
+	{
+		joinThread(&helpers[a].thread);
+		s.nodes += helpers[a].s.nodes;
+		s.cutoffs += helpers[a].s.cutoffs;
+		s.firstCutoffs += helpers[a].s.firstCutoffs;
+	}
+	free(helpers);
+
+	result->nodes = s.nodes;
+	result->cutoffs = s.cutoffs;
+	result->firstCutoffs = s.firstCutoffs;
+}
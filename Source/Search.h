@@ -0,0 +1,108 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Search header.
+//*
+//* Game tree search for the computer move. Negamax alpha-beta search with iterative deepening, so the search can be
+//* given a depth or a time limit, and scores from a static evaluation at the end of each line of moves. Near the end of
+//* the game the endgame solver plays out every line to the end instead.
+//*
+//************************************************************************************************************************
+#pragma once
+
+#include "Bitboard.h"				// Bitboard board representation.
+#include "Hash.h"					// Transposition table.
+
+// Scores are from the point of view of the player to move, in hundredths of a disc. A finished game scores the
+// difference in pieces, and the evaluation of an unfinished game is an estimate on the same scale.
+#define DISCSCORE 100					// Score for one piece more than the opponent at the end of the game.
+#define MAXSCORE  (NSQUARES * DISCSCORE)	// Highest score there can be (all the pieces).
+#define INFSCORE  (MAXSCORE + 1)			// Higher than any score, for the starting search window.
+
+#define MAXDEPTH (NSQUARES - 4)		// Deepest search there can be (one move for each empty square at the start).
+
+// Weightings for the static evaluation, in hundredths of a disc. They can be changed (by the self-play optimisation)
+// to tune the computer play, though the Multi-ProbCut lines are only fitted for the defaults.
+typedef struct evalWeights evalWeights_t;
+
+struct evalWeights
+{
+	int corner;			// Score for each corner held.
+	int xSquare;		// Score for each piece diagonally next to an empty corner (gives the corner away).
+	int cSquare;		// Score for each piece on an edge next to an empty corner.
+	int mobility;		// Score for each valid move more than the opponent.
+	int potential;		// Score for each empty square next to an opponent piece, more than the opponent has.
+};
+
+extern const evalWeights_t defaultEval;	// Weightings used when none are given.
+
+// Limits on how far the search goes, and the search methods to use.
+typedef struct searchLimits searchLimits_t;
+
+struct searchLimits
+{
+	int depth;			// Deepest search, in moves.
+	int millis;			// Time allowed in milliseconds, or 0 for no time limit. The search stops at the end of the last full depth.
+	bool pvs;			// Use principal variation search (null windows after the first move), otherwise plain alpha-beta.
+	bool aspiration;	// Start each depth with a narrow window around the score from the depth before.
+	bool mtdf;			// Find the score of each depth (and of an exact solve) with MTD(f), a series of null window searches.
+	bool probcut;		// Cut off positions where a shallow search shows a deep search is almost certain to be outside the window.
+	int solve;			// Solve the game exactly, ignoring the depth, within half the time when there are at most this many empty
+						// squares (0 never).
+	int wld;			// Solve for only win, loss or draw, within half the time left, when there are at most this many empty squares
+						// (0 never), or when the exact solve runs out of time. If that runs out of time or finds a loss, the search
+						// is used instead.
+	int threads;		// Number of threads to search with (Lazy SMP), 0 for one on each core.
+	const evalWeights_t* eval;	// Weightings for the evaluation, or NULL for defaultEval.
+};
+
+// Multi-ProbCut. The score of a deep search is predicted from a shallow search by a straight line, deep = a * shallow + b,
+// with sigma the spread (standard deviation) of the deep scores about the line. The line is fitted separately for each
+// depth and stage of the game, by Tools/Calibrate.c from positions in games the engine plays against itself.
+typedef struct probCut probCut_t;
+
+struct probCut
+{
+	int shallow;	// Depth of the shallow search, 0 if there is no fit for the depth.
+	int a;			// Slope of the line, times 1024.
+	int b;			// Offset of the line.
+	int sigma;		// Spread of the deep scores about the line.
+};
+
+#define MPCSTAGES 4		// Stages of the game with separate fits, by the number of empty squares.
+
+// Stage of the game from the number of empty squares, 0 (the end) to MPCSTAGES - 1 (the start).
+static inline int probCutStage(int empties)
+{
+	int stage = ((empties - 1) * MPCSTAGES) / (NSQUARES - 4);
+
+	return (stage < MPCSTAGES) ? stage : MPCSTAGES - 1;
+}
+
+// Kind of search that gave the result.
+enum searchMode_e { MODE_SEARCH, MODE_MTDF, MODE_WLD, MODE_EXACT };	// Search to a depth, the same with MTD(f), win/loss/draw solve, exact solve.
+
+// Result of a search.
+typedef struct searchResult searchResult_t;
+
+struct searchResult
+{
+	int move;					// Best move found, or PASS if there are no moves.
+	int score;					// Score of the best move. For a win/loss/draw solve it is DISCSCORE for a win, 0 for a draw and -DISCSCORE for a loss.
+	int depth;					// Depth of the last full search (the number of empty squares for a solve).
+	int mode;					// Kind of search, from searchMode_e.
+	unsigned long long nodes;	// Number of positions searched.
+	unsigned long long cutoffs;			// Number of positions where a move cut off the search.
+	unsigned long long firstCutoffs;	// Number of those where it was the first move searched (shows how good the move ordering is).
+};
+
+int evaluate(const position_t* pos, const evalWeights_t* w);	// Static evaluation of a position for the player to move.
+
+long long getMillis(void);				// Time in milliseconds from any starting point, for the time limits.
+
+void searchPosition(const position_t* pos, const int* order, int n, const searchLimits_t* limits, hashTable_t* hash, searchResult_t* result);
+										// Search for the best move. The n moves in order are searched first in the order given (to
+										// break ties between equal moves), order can be NULL. Any other moves are searched after them.
+										// Results are kept in the hash table, which can be empty.
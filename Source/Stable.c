@@ -0,0 +1,198 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Stable
+//*
+//* Stable pieces are found in two parts:
+//*
+//* A piece on an edge can only be flipped along the edge, so whether it is stable only depends on the pieces on that
+//* edge. A table has the stable pieces for every arrangement of pieces on an edge (3 to the power of the board size,
+//* 6561 for the 8x8 board), worked out by trying every order the empty squares on the edge could be filled in.
+//*
+//* A piece away from the edges is stable if, in each of the four directions (across, down and the two diagonals), the
+//* line through it is full or it is next to a stable piece of its own. Starting from the stable edge pieces this is
+//* repeated until no more stable pieces are found.
+//*
+//************************************************************************************************************************
+#include "Stable.h"			// Stable pieces API.
+
+#if BOARDSIZE == 6
+#define EDGECONFIGS 729		// Arrangements of an edge, 3 to the power of the board size.
+#elif BOARDSIZE == 8
+#define EDGECONFIGS 6561
+#else
+#define EDGECONFIGS 59049
+#endif
+
+#define LINEMASK ((1 << BOARDSIZE) - 1)	// All of the squares on an edge.
+#define NOTDONE  0xffff					// Table entry not worked out yet.
+#define NLINES   (2 * BOARDSIZE - 1)	// Most lines in one direction (the diagonals).
+
+// Squares away from the edges.
+#define CENTRE (BOARDMASK & ~(COLUMN1 | COLUMNN | LINEMASK | ((bitboard_t)LINEMASK << (NSQUARES - BOARDSIZE))))
+
+static bool ready = false;						// Set once the tables have been worked out.
+static uint16_t base3[1 << BOARDSIZE];			// Edge pieces as a base 3 number, with each piece a 1.
+static uint16_t edgeTable[EDGECONFIGS];			// Stable pieces for the player with the own pieces, for each edge arrangement.
+static bitboard_t lines[4][NLINES];				// Squares on each line, across, down and the two diagonals.
+static int nlines[4];							// Number of lines in each direction.
+
+// Index of an edge arrangement, with own pieces counting 1 and opponent pieces 2 in each base 3 digit.
+static inline int edgeIndex(int own, int opp)
+{
+	return base3[own] + (2 * base3[opp]);
+}
+
+// Play a piece at square x of an edge for the player with the mover pieces, flipping the other player's pieces that are
+// between it and a mover piece. Returns the pieces flipped.
+static int playEdge(int mover, int other, int x)
+{
+	int flips = 0;
+	int y;
+
+	// Towards square 0.
+	for (y = x - 1; (y >= 0) && (other & (1 << y)); y--) {}
+	if ((y >= 0) && (y < x - 1) && (mover & (1 << y))) { flips |= ((1 << x) - 1) & ~((2 << y) - 1); }
+
+	// Towards the last square.
+	for (y = x + 1; (y < BOARDSIZE) && (other & (1 << y)); y++) {}
+	if ((y < BOARDSIZE) && (y > x + 1) && (mover & (1 << y))) { flips |= ((1 << y) - 1) & ~((2 << x) - 1); }
+
+	return flips;
+}
+
+// Work out the stable own pieces of an edge. A piece is stable if it is still an own piece after any move on the edge,
+// by either player, and is stable in the edge that move leaves. Each result is kept in the table, so each arrangement is
+// only worked out once.
+static int edgeStable(int own, int opp)
+{
+	int index = edgeIndex(own, opp);
+	int empty = LINEMASK & ~(own | opp);
+	int stable = own;
+
+	if (edgeTable[index] != NOTDONE) { return edgeTable[index]; }
+
+	for (int x = 0; (x < BOARDSIZE) && (stable != 0); x++)
+	{
+		if (empty & (1 << x))
+		{
+			int flips = playEdge(own, opp, x);			// Own piece played.
+			stable &= edgeStable(own | flips | (1 << x), opp & ~flips);
+
+			flips = playEdge(opp, own, x);				// Opponent piece played.
+			stable &= edgeStable(own & ~flips, opp | flips | (1 << x));
+		}
+	}
+	edgeTable[index] = (uint16_t)stable;
+	return stable;
+}
+
+// Add a line of squares, starting from column x and row y (counted from 0) and stepping by dx and dy.
+// Lines that only have edge squares (the edges themselves and the short diagonals at the corners) are left out, as only
+// the pieces away from the edges are found from full lines.
+static void addLine(int dir, int x, int y, int dx, int dy)
+{
+	bitboard_t line = 0;
+
+	for (; (x >= 0) && (x < BOARDSIZE) && (y >= 0) && (y < BOARDSIZE); x += dx, y += dy) { line |= SQUAREBIT((y * BOARDSIZE) + x); }
+	if (line & CENTRE) { lines[dir][nlines[dir]++] = line; }
+}
+
+// Work out the tables.
+void initStable(void)
+{
+	if (ready) { return; }
+
+	for (int b = 0; b < (1 << BOARDSIZE); b++)
+	{
+		int n = 0;
+
+		for (int x = BOARDSIZE - 1; x >= 0; x--) { n = (n * 3) + ((b >> x) & 1); }
+		base3[b] = (uint16_t)n;
+	}
+
+	for (int a = 0; a < EDGECONFIGS; a++) { edgeTable[a] = NOTDONE; }
+	for (int own = 0; own < (1 << BOARDSIZE); own++)
+	{
+		for (int opp = 0; opp < (1 << BOARDSIZE); opp++)
+		{
+			if ((own & opp) == 0) { edgeStable(own, opp); }
+		}
+	}
+
+	for (int a = 0; a < BOARDSIZE; a++)
+	{
+		addLine(0, 0, a, 1, 0);		// Rows.
+		addLine(1, a, 0, 0, 1);		// Columns.
+	}
+	for (int a = 0; a < BOARDSIZE; a++)
+	{
+		addLine(2, a, 0, 1, 1);		// Diagonals down and right, from the top row and then the left column.
+		addLine(3, a, 0, -1, 1);	// Diagonals down and left, from the top row and then the right column.
+	}
+	for (int a = 1; a < BOARDSIZE; a++)
+	{
+		addLine(2, 0, a, 1, 1);
+		addLine(3, BOARDSIZE - 1, a, -1, 1);
+	}
+	ready = true;
+}
+
+// Get the squares on full lines in a direction.
+static inline bitboard_t fullLines(bitboard_t full, int dir)
+{
+	bitboard_t result = 0;
+
+	for (int a = 0; a < nlines[dir]; a++)
+	{
+		if ((full & lines[dir][a]) == lines[dir][a]) { result |= lines[dir][a]; }
+	}
+	return result;
+}
+
+// Get the stable own pieces on the four edges. The columns are made into rows by swapping x and y, so all of the edges
+// can be looked up the same way.
+static bitboard_t stableEdges(bitboard_t own, bitboard_t opp)
+{
+	const int last = NSQUARES - BOARDSIZE;	// First square of the last row.
+	bitboard_t swapOwn = transformBitboard(own, TRANSFORM_SWAPXY);
+	bitboard_t swapOpp = transformBitboard(opp, TRANSFORM_SWAPXY);
+	bitboard_t rows, columns;
+
+	rows  = (bitboard_t)edgeTable[edgeIndex((int)(own & LINEMASK), (int)(opp & LINEMASK))];
+	rows |= (bitboard_t)edgeTable[edgeIndex((int)(own >> last), (int)(opp >> last))] << last;
+	columns  = (bitboard_t)edgeTable[edgeIndex((int)(swapOwn & LINEMASK), (int)(swapOpp & LINEMASK))];
+	columns |= (bitboard_t)edgeTable[edgeIndex((int)(swapOwn >> last), (int)(swapOpp >> last))] << last;
+	return rows | transformBitboard(columns, TRANSFORM_SWAPXY);
+}
+
+// Get the stable own pieces.
+bitboard_t getStable(bitboard_t own, bitboard_t opp)
+{
+	if (!ready) { initStable(); }
+
+	bitboard_t full = own | opp;
+	bitboard_t across = fullLines(full, 0);
+	bitboard_t down = fullLines(full, 1);
+	bitboard_t diag1 = fullLines(full, 2);
+	bitboard_t diag2 = fullLines(full, 3);
+	bitboard_t centre = own & CENTRE;
+	bitboard_t stable = stableEdges(own, opp) | (centre & across & down & diag1 & diag2);
+	bitboard_t last;
+
+	// Add pieces that are next to stable pieces (or on a full line) in all four directions, until no more are found.
+	// Only pieces away from the edges are looked at, so the shifts never wrap round from one side of the board to the other.
+	do
+	{
+		last = stable;
+		stable |= centre &
+			(across | (stable << 1) | (stable >> 1)) &
+			(down | (stable << BOARDSIZE) | (stable >> BOARDSIZE)) &
+			(diag1 | (stable << (BOARDSIZE + 1)) | (stable >> (BOARDSIZE + 1))) &
+			(diag2 | (stable << (BOARDSIZE - 1)) | (stable >> (BOARDSIZE - 1)));
+	} while (stable != last);
+
+	return stable;
+}
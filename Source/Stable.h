@@ -0,0 +1,19 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Stable header.
+//*
+//* Stable pieces are pieces that can never be flipped, whatever moves are played for the rest of the game. They set a
+//* limit on the final score, which the search uses to cut off positions that cannot reach the score it needs.
+//*
+//************************************************************************************************************************
+#pragma once
+
+#include "Bitboard.h"				// Bitboard board representation.
+
+void initStable(void);					// Work out the tables used to find stable pieces. This is done by the first call to
+										// getStable, but should be called first if there is more than one thread.
+
+bitboard_t getStable(bitboard_t own, bitboard_t opp);	// Get the pieces of the player with the own pieces that can never be flipped.
@@ -0,0 +1,169 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Thread
+//*
+//* Starting and joining threads on each platform. On the Wii U each thread is put on a different core from the calling
+//* thread (thread n on the core n after it), with the same priority, and its stack is allocated with it.
+//*
+//************************************************************************************************************************
+#include <stddef.h>			// For NULL.
+
+#include "Thread.h"			// Thread API.
+
+#if defined(__WIIU__)
+#include <stdlib.h>			// For malloc and free.
+#include <stdint.h>			// For uintptr_t.
+#include <coreinit/core.h>	// For the core number.
+#include <coreinit/thread.h>	// For the system threads.
+
+#define WIIUCORES 3			// Cores on the Wii U.
+#define STACKSIZE (128 * 1024)	// Stack for each thread, plenty for the deepest search.
+#define STACKALIGN 16		// Alignment of the thread and its stack.
+
+// Run the thread function. The thread is passed as the argument list, as coreinit threads take a main style function.
+static int threadMain(int argc, const char** argv)
+{
+	thread_t* t = (thread_t*)argv;
+
+	(void)argc;
+	t->function(t->arg);
+	return 0;
+}
+
+// The system thread and its stack are allocated together, the stack after the thread aligned to STACKALIGN.
+bool startThread(thread_t* t, int n, threadFunction_t function, void* arg)
+{
+	size_t size = ((sizeof(OSThread) + STACKALIGN - 1) & ~(size_t)(STACKALIGN - 1)) + STACKSIZE;
+	void* memory = malloc(size + STACKALIGN);
+
+	t->function = function;
+	t->arg = arg;
+	t->handle = memory;
+	if (memory == NULL) { return false; }
+
+	OSThread* os = (OSThread*)(((uintptr_t)memory + STACKALIGN - 1) & ~(uintptr_t)(STACKALIGN - 1));
+	uint8_t* stack = (uint8_t*)os + size - STACKSIZE;
+	int core = (int)((OSGetCoreId() + n) % WIIUCORES);
+
+	// The stack grows down, so it is given by its top.
+	if (!OSCreateThread(os, threadMain, 0, (char*)t, stack + STACKSIZE, STACKSIZE, OSGetThreadPriority(OSGetCurrentThread()),
+		(OSThreadAttributes)(OS_THREAD_ATTRIB_AFFINITY_CPU0 << core)))
+	{
+		free(memory);
+		t->handle = NULL;
+		return false;
+	}
+	OSResumeThread(os);
+	return true;
+}
+
+void joinThread(thread_t* t)
+{
+	if (t->handle == NULL) { return; }
+
+	int result;
+
+	OSJoinThread((OSThread*)(((uintptr_t)t->handle + STACKALIGN - 1) & ~(uintptr_t)(STACKALIGN - 1)), &result);
+	free(t->handle);
+	t->handle = NULL;
+}
+
+int getCores(void)
+{
+	return WIIUCORES;
+}
+
+void yieldThread(void)
+{
+	OSYieldThread();
+}
+
+// Priority 0 is the highest and 31 the lowest.
+void lowerPriority(void)
+{
+	OSThread* os = OSGetCurrentThread();
+	int priority = OSGetThreadPriority(os);
+
+	if (priority < 31) { OSSetThreadPriority(os, priority + 1); }
+}
+
+#elif defined(__cplusplus)
+#include <thread>			// For std::thread.
+
+bool startThread(thread_t* t, int n, threadFunction_t function, void* arg)
+{
+	(void)n;
+	t->function = function;
+	t->arg = arg;
+	try
+	{
+		t->handle = new std::thread(function, arg);
+	}
+	catch (...)
+	{
+		t->handle = NULL;
+		return false;
+	}
+	return true;
+}
+
+void joinThread(thread_t* t)
+{
+	if (t->handle == NULL) { return; }
+
+	std::thread* thread = static_cast<std::thread*>(t->handle);
+
+	thread->join();
+	delete thread;
+	t->handle = NULL;
+}
+
+int getCores(void)
+{
+	unsigned int cores = std::thread::hardware_concurrency();
+
+	return (cores > 0) ? (int)cores : 1;
+}
+
+void yieldThread(void)
+{
+	std::this_thread::yield();
+}
+
+// The host has cores to spare, so the priority is left as it is.
+void lowerPriority(void)
+{
+}
+
+#else	// No threads, everything runs on the calling thread.
+
+bool startThread(thread_t* t, int n, threadFunction_t function, void* arg)
+{
+	(void)n;
+	t->function = function;
+	t->arg = arg;
+	t->handle = NULL;
+	return false;
+}
+
+void joinThread(thread_t* t)
+{
+	(void)t;
+}
+
+int getCores(void)
+{
+	return 1;
+}
+
+void yieldThread(void)
+{
+}
+
+void lowerPriority(void)
+{
+}
+#endif
@@ -0,0 +1,113 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Thread header.
+//*
+//* Threads for the parallel search. The Wii U build uses coreinit threads, one on each of its three cores, and the host
+//* build (compiled as C++) uses std::thread. A build with neither (plain C on a PC) cannot start threads, so the search
+//* runs on the calling thread only.
+//*
+//************************************************************************************************************************
+#pragma once
+
+#include <stdbool.h>				// To use booleans.
+
+#define MAXTHREADS 64				// Most search threads, including the calling thread.
+
+typedef void (*threadFunction_t)(void* arg);	// Function run by a thread.
+
+// A started thread.
+typedef struct thread thread_t;
+
+struct thread
+{
+	threadFunction_t function;	// Function the thread runs.
+	void* arg;					// Argument passed to it.
+	void* handle;				// System thread, and its stack on the Wii U.
+};
+
+int getCores(void);					// Number of processor cores, so the number of threads worth running.
+
+bool startThread(thread_t* t, int n, threadFunction_t function, void* arg);	// Start thread n (1 upwards, the calling thread is 0),
+																			// returns false if it could not be started.
+
+void joinThread(thread_t* t);		// Wait for a started thread to finish.
+
+void yieldThread(void);				// Let other threads run, while waiting for something.
+
+void lowerPriority(void);			// Run the calling thread, and the threads it starts, behind the others, so a search in the
+									// background does not hold up the display.
+
+// Values shared between threads are read and written with these, so that each is done in one go and is seen by the other
+// threads. A build without gcc or clang has no threads, so plain reads and writes do.
+static inline bool readFlag(const bool* flag)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_load_n(flag, __ATOMIC_ACQUIRE);
+#else
+	return *(volatile const bool*)flag;
+#endif
+}
+
+static inline void setFlag(bool* flag)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__atomic_store_n(flag, true, __ATOMIC_RELEASE);
+#else
+	*(volatile bool*)flag = true;
+#endif
+}
+
+static inline int readShared(const int* value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#else
+	return *(volatile const int*)value;
+#endif
+}
+
+static inline void writeShared(int* value, int write)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__atomic_store_n(value, write, __ATOMIC_RELEASE);
+#else
+	*(volatile int*)value = write;
+#endif
+}
+
+static inline int addShared(int* value, int add)	// Returns the value before the add.
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __atomic_fetch_add(value, add, __ATOMIC_ACQ_REL);
+#else
+	int old = *value;
+
+	*value = old + add;
+	return old;
+#endif
+}
+
+// Spin lock, for data that is only held for a moment. 0 is unlocked.
+static inline void lockSpin(int* lock)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	while (__atomic_exchange_n(lock, 1, __ATOMIC_ACQUIRE) != 0)
+	{
+		while (__atomic_load_n(lock, __ATOMIC_RELAXED) != 0) {}
+	}
+#else
+	*lock = 1;
+#endif
+}
+
+static inline void unlockSpin(int* lock)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+#else
+	*lock = 0;
+#endif
+}
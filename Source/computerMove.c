@@ -9,12 +9,12 @@
 //* This includes a dummy version of the human move that is mainly random to try out the computerMove.
 //* It also includes self-play to play the computerMove against the dummy human to try out different weightings.
 //* The weightings are updated each time they reduce the number of lost games, aiming to optimise the constant values used.
+//* Both the move scores and the evaluation used by the search are tuned.
 //*
 //************************************************************************************************************************
-#include <stdlib.h>			// For rand.
-
 #include "Game.h"			// Game API.
 #include "computerMove.h"	// Access to other Game functions to support computer move.
+#include "Search.h"			// Search ahead for the best move.
 
 #ifdef PLAYSELF
 #include <iostream>			// For std::cout. Only needed for optimisation.
@@ -31,293 +31,297 @@ struct validMove
 	int score;		// Calculated score used to select valid moves.
 };
 
-enum difficulty_e difficulty = MEDIUM;	// Difficulty level for the game (adjusts how the computer plays).
-
-// Integer constant weightings used for calculating moves. These are variable to support optimisation.
-int EDG =   1;	// Score for an edge position.
-int EG2 =   5;	// Score for edge next to a corner we have.
-int CNR =  15;	// Score for a corner position.
-int CNO = -13;	// Score for possible corner for opponent.
-int CN2 =   8;	// Score for possible corner next move.
-int NCN = -15;	// Score for playing next to an available corner.
-int JIN =   4;	// Score for a position in the quadrant near a corner the computer holds.
-int BTW =   1;	// Score for playing between opponent pieces (harder to flip). 
-int BTO =   4;	// Score for playing between own pieces to fill in the gaps.
-int DIG =  12;	// Score for playing to take advantage of the opponent playing next to a corner.
-
-float losses = 300.0f;	// Count to check how many games lost in optimisation run.
-
-// Calculate the computer move. Find all valid moves for the current play and assess each move to give it a score.
-// The select the move with the highest score. Various aspects of the move are considered such as on an edge or corner.
-void computerMove(void)
+// Starting weightings used for calculating moves. Each engine has its own copy, which optimisation can vary.
+const weights_t defaultWeights =
+{
+	  1,	// EDG Score for an edge position.
+	  5,	// EG2 Score for edge next to a corner we have.
+	 15,	// CNR Score for a corner position.
+	-13,	// CNO Score for possible corner for opponent.
+	  8,	// CN2 Score for possible corner next move.
+	-15,	// NCN Score for playing next to an available corner.
+	  4,	// JIN Score for a position in the quadrant near a corner the computer holds.
+	  1,	// BTW Score for playing between opponent pieces (harder to flip).
+	  4,	// BTO Score for playing between own pieces to fill in the gaps.
+	 12,	// DIG Score for playing to take advantage of the opponent playing next to a corner.
+	 400,	// COR Score for each corner held (the search evaluation weightings, the same as defaultEval).
+	-200,	// XSQ Score for each piece diagonally next to an empty corner.
+	 -50,	// CSQ Score for each piece on an edge next to an empty corner.
+	  60,	// MOB Score for each valid move more than the opponent.
+	  20,	// POT Score for each empty square next to an opponent piece, more than the opponent has.
+};
+
+// How far the computer searches ahead at each difficulty level, in moves, and the time allowed in milliseconds (0 for no limit).
+// The evaluation weightings are left NULL here, and set from the engine's weightings for each search.
+static const searchLimits_t levels[3] =
 {
-	validMove_t validMoves[60];	// Array to store valid moves (60 is the maximum number of available spaces on the board at the start of the game).
+	{ 1, 0, true, true, false, false, 0, 0, 1, NULL },									// EASY only looks at the position after each move.
+	{ 3, 0, true, true, false, false, 0, 0, 1, NULL },									// MEDIUM looks at the opponent's replies and its own next move.
+	{ MAXDEPTH, 1000, true, true, false, true, SOLVEEMPTIES, WLDEMPTIES, 0, NULL },	// HARD searches as deep as it can in a second on all of the cores,
+																					// leaving out lines that are almost certainly no good. Near the end
+																					// of the game it plays for a proved win or draw, then perfectly.
+};
+
+// The four corner squares.
+static const bitboard_t corners = SQUAREBIT(SQUARE(1, 1)) | SQUAREBIT(SQUARE(BOARDSIZE, 1)) | SQUAREBIT(SQUARE(1, BOARDSIZE)) | SQUAREBIT(SQUARE(BOARDSIZE, BOARDSIZE));
+
+// Choose the computer move. Find all valid moves for the current play and assess each move to give it a score.
+// Various aspects of the move are considered such as on an edge or corner. Then search ahead, with the moves in
+// order of score, to select the best move. The engine is only read (apart from the hash table), so this can run on
+// another thread while the game table is displayed. The square of the move is returned.
+static int chooseMove(engine_t* eng)
+{
+	const weights_t* w = &eng->weights;	// Weightings used to score the moves.
+	validMove_t validMoves[NSQUARES - 4];	// Array to store valid moves (the number of available spaces on the board at the start of the game is the most there can be).
 	unsigned int moveN = 0;		// Valid Move count for validMoves array.
-	unsigned int selN  = 0;		// Selected valid move.
-	int captN = 0;				// Used to record the highest score to select the best move.
+	int order[NSQUARES - 4];	// Valid moves in order of score, highest first.
+	searchResult_t result;		// Move selected by the search.
+	searchLimits_t limits = levels[eng->difficulty];	// How far to search, with the engine's evaluation weightings.
+	evalWeights_t eval;
 	int vcnt = 0;				// Count of valid moves available to the opponent.
+	moveStack_t working;		// Working copy of the game position, moves are tried out and taken back so the game board is not corrupted.
+	bitboard_t oppMoves;		// Valid moves available to the opponent after trying a move.
+	bitboard_t ownMoves;		// Valid moves available to the computer after trying a move.
+
+	startStack(&working, &eng->position);	// Copy the current game to a working position for processing.
 
 	// Go through the entire board looking for valid moves 'V's and log the board positions in the validMoves array.
 	// Note board positions are labelled 1-8 left to right and 1-8 top to bottom, 1,1 is top left.
 	// Then process move to determine a score for how good that move is.
-	for (unsigned int x = 1; x <= 8; x++)
+	for (unsigned int x = 1; x <= BOARDSIZE; x++)
 	{
-		for (unsigned int y = 1; y <= 8; y++)
+		for (unsigned int y = 1; y <= BOARDSIZE; y++)
 		{
 			// If a valid move is found capture the position.
-			if (gameTable[x][y] == 'V')
+			if (eng->valid & SQUAREBIT(SQUARE(x, y)))
 			{
 				validMoves[moveN].x = x;
 				validMoves[moveN].y = y;
 				validMoves[moveN].score = 0;
 
 				// If the move is next to an edge give it a slight increase in score.
-				if (x == 2) { validMoves[moveN].score = validMoves[moveN].score + BTO; }
-				if (x == 7) { validMoves[moveN].score = validMoves[moveN].score + BTO; }
-				if (y == 2) { validMoves[moveN].score = validMoves[moveN].score + BTO; }
-				if (y == 7) { validMoves[moveN].score = validMoves[moveN].score + BTO; }
+				if (x == 2) { validMoves[moveN].score = validMoves[moveN].score + w->BTO; }
+				if (x == BOARDSIZE - 1) { validMoves[moveN].score = validMoves[moveN].score + w->BTO; }
+				if (y == 2) { validMoves[moveN].score = validMoves[moveN].score + w->BTO; }
+				if (y == BOARDSIZE - 1) { validMoves[moveN].score = validMoves[moveN].score + w->BTO; }
 
 				// If the valid move is on an edge then increase the score as edges are preferable as they are harder to flip. Look for edges not next to the opponent.
-				if ((x == 1) && (gameTable[1][y - 1] != 'R') && (gameTable[1][y + 1] != 'R')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((x == 8) && (gameTable[8][y - 1] != 'R') && (gameTable[1][y + 1] != 'R')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((y == 1) && (gameTable[x - 1][1] != 'R') && (gameTable[x + 1][1] != 'R')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((y == 8) && (gameTable[x - 1][8] != 'R') && (gameTable[x + 1][8] != 'R')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
+				if ((x == 1) && (tableCell(eng, 1, y - 1) != 'R') && (tableCell(eng, 1, y + 1) != 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((x == BOARDSIZE) && (tableCell(eng, BOARDSIZE, y - 1) != 'R') && (tableCell(eng, 1, y + 1) != 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((y == 1) && (tableCell(eng, x - 1, 1) != 'R') && (tableCell(eng, x + 1, 1) != 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((y == BOARDSIZE) && (tableCell(eng, x - 1, BOARDSIZE) != 'R') && (tableCell(eng, x + 1, BOARDSIZE) != 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
 
 				// If the valid move is one of the four corners increase score as corners cannot be flipped.
-				if ((x == 1) && (y == 1)) { validMoves[moveN].score = validMoves[moveN].score + CNR; }
-				if ((x == 1) && (y == 8)) { validMoves[moveN].score = validMoves[moveN].score + CNR; }
-				if ((x == 8) && (y == 1)) { validMoves[moveN].score = validMoves[moveN].score + CNR; }
-				if ((x == 8) && (y == 8)) { validMoves[moveN].score = validMoves[moveN].score + CNR; }
+				if ((x == 1) && (y == 1)) { validMoves[moveN].score = validMoves[moveN].score + w->CNR; }
+				if ((x == 1) && (y == BOARDSIZE)) { validMoves[moveN].score = validMoves[moveN].score + w->CNR; }
+				if ((x == BOARDSIZE) && (y == 1)) { validMoves[moveN].score = validMoves[moveN].score + w->CNR; }
+				if ((x == BOARDSIZE) && (y == BOARDSIZE)) { validMoves[moveN].score = validMoves[moveN].score + w->CNR; }
 
 				// If we have a corner, favour moves along edges next to the corner.
-				if ((gameTable[1][1] == 'G') && ((x == 1) || (y == 1))) { validMoves[moveN].score = validMoves[moveN].score + EG2; }
-				if ((gameTable[1][8] == 'G') && ((x == 1) || (y == 8))) { validMoves[moveN].score = validMoves[moveN].score + EG2; }
-				if ((gameTable[8][1] == 'G') && ((x == 8) || (y == 1))) { validMoves[moveN].score = validMoves[moveN].score + EG2; }
-				if ((gameTable[8][8] == 'G') && ((x == 8) || (y == 8))) { validMoves[moveN].score = validMoves[moveN].score + EG2; }
+				if ((tableCell(eng, 1, 1) == 'G') && ((x == 1) || (y == 1))) { validMoves[moveN].score = validMoves[moveN].score + w->EG2; }
+				if ((tableCell(eng, 1, BOARDSIZE) == 'G') && ((x == 1) || (y == BOARDSIZE))) { validMoves[moveN].score = validMoves[moveN].score + w->EG2; }
+				if ((tableCell(eng, BOARDSIZE, 1) == 'G') && ((x == BOARDSIZE) || (y == 1))) { validMoves[moveN].score = validMoves[moveN].score + w->EG2; }
+				if ((tableCell(eng, BOARDSIZE, BOARDSIZE) == 'G') && ((x == BOARDSIZE) || (y == BOARDSIZE))) { validMoves[moveN].score = validMoves[moveN].score + w->EG2; }
 
 				// Avoid giving away a corner, by playing a position next to an available corner.
-				if ((x == 2) && (y == 2) && (gameTable[1][1] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
-				if ((x == 1) && (y == 2) && (gameTable[1][1] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
-				if ((x == 2) && (y == 1) && (gameTable[1][1] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
-				if ((x == 7) && (y == 7) && (gameTable[8][8] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
-				if ((x == 7) && (y == 8) && (gameTable[8][8] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
-				if ((x == 8) && (y == 7) && (gameTable[8][8] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
-				if ((x == 7) && (y == 2) && (gameTable[8][1] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
-				if ((x == 7) && (y == 1) && (gameTable[8][1] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
-				if ((x == 8) && (y == 2) && (gameTable[8][1] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
-				if ((x == 2) && (y == 7) && (gameTable[1][8] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
-				if ((x == 1) && (y == 7) && (gameTable[1][8] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
-				if ((x == 2) && (y == 8) && (gameTable[1][8] == ' ')) { validMoves[moveN].score = validMoves[moveN].score + NCN; }
+				if ((x == 2) && (y == 2) && (tableCell(eng, 1, 1) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
+				if ((x == 1) && (y == 2) && (tableCell(eng, 1, 1) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
+				if ((x == 2) && (y == 1) && (tableCell(eng, 1, 1) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
+				if ((x == BOARDSIZE - 1) && (y == BOARDSIZE - 1) && (tableCell(eng, BOARDSIZE, BOARDSIZE) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
+				if ((x == BOARDSIZE - 1) && (y == BOARDSIZE) && (tableCell(eng, BOARDSIZE, BOARDSIZE) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
+				if ((x == BOARDSIZE) && (y == BOARDSIZE - 1) && (tableCell(eng, BOARDSIZE, BOARDSIZE) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
+				if ((x == BOARDSIZE - 1) && (y == 2) && (tableCell(eng, BOARDSIZE, 1) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
+				if ((x == BOARDSIZE - 1) && (y == 1) && (tableCell(eng, BOARDSIZE, 1) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
+				if ((x == BOARDSIZE) && (y == 2) && (tableCell(eng, BOARDSIZE, 1) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
+				if ((x == 2) && (y == BOARDSIZE - 1) && (tableCell(eng, 1, BOARDSIZE) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
+				if ((x == 1) && (y == BOARDSIZE - 1) && (tableCell(eng, 1, BOARDSIZE) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
+				if ((x == 2) && (y == BOARDSIZE) && (tableCell(eng, 1, BOARDSIZE) == ' ')) { validMoves[moveN].score = validMoves[moveN].score + w->NCN; }
 
 				// If you have an edge piece and the opponent tries to take it, consider taking them instead.
-				if ((y == 1) && (gameTable[x - 1][1] == 'R') && (gameTable[x - 2][1] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((y == 1) && (gameTable[x + 1][1] == 'R') && (gameTable[x + 2][1] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((y == 8) && (gameTable[x - 1][8] == 'R') && (gameTable[x - 2][8] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((y == 8) && (gameTable[x + 1][8] == 'R') && (gameTable[x + 2][8] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((x == 1) && (gameTable[1][y - 1] == 'R') && (gameTable[1][y - 2] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((x == 1) && (gameTable[1][y + 1] == 'R') && (gameTable[1][y + 2] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((x == 8) && (gameTable[8][y - 1] == 'R') && (gameTable[8][y - 2] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((x == 8) && (gameTable[8][y + 1] == 'R') && (gameTable[8][y + 2] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
+				if ((y == 1) && (tableCell(eng, x - 1, 1) == 'R') && (tableCell(eng, x - 2, 1) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((y == 1) && (tableCell(eng, x + 1, 1) == 'R') && (tableCell(eng, x + 2, 1) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((y == BOARDSIZE) && (tableCell(eng, x - 1, BOARDSIZE) == 'R') && (tableCell(eng, x - 2, BOARDSIZE) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((y == BOARDSIZE) && (tableCell(eng, x + 1, BOARDSIZE) == 'R') && (tableCell(eng, x + 2, BOARDSIZE) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((x == 1) && (tableCell(eng, 1, y - 1) == 'R') && (tableCell(eng, 1, y - 2) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((x == 1) && (tableCell(eng, 1, y + 1) == 'R') && (tableCell(eng, 1, y + 2) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((x == BOARDSIZE) && (tableCell(eng, BOARDSIZE, y - 1) == 'R') && (tableCell(eng, BOARDSIZE, y - 2) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((x == BOARDSIZE) && (tableCell(eng, BOARDSIZE, y + 1) == 'R') && (tableCell(eng, BOARDSIZE, y + 2) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
 
 				// Increase the score next to a corner to avoid losing a whole edge, if the opponent plays next to it.
-				if ((y == 1) && (x == 7) && (gameTable[x - 1][1] == 'R') && (gameTable[x - 2][1] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + DIG; }
-				if ((y == 1) && (x == 2) && (gameTable[x + 1][1] == 'R') && (gameTable[x + 2][1] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + DIG; }
-				if ((y == 8) && (x == 7) && (gameTable[x - 1][8] == 'R') && (gameTable[x - 2][8] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + DIG; }
-				if ((y == 8) && (x == 2) && (gameTable[x + 1][8] == 'R') && (gameTable[x + 2][8] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + DIG; }
-				if ((x == 1) && (y == 7) && (gameTable[1][y - 1] == 'R') && (gameTable[1][y - 2] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + DIG; }
-				if ((x == 1) && (y == 2) && (gameTable[1][y + 1] == 'R') && (gameTable[1][y + 2] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + DIG; }
-				if ((x == 8) && (y == 7) && (gameTable[8][y - 1] == 'R') && (gameTable[8][y - 2] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + DIG; }
-				if ((x == 8) && (y == 2) && (gameTable[8][y + 1] == 'R') && (gameTable[8][y + 2] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + DIG; }
+				if ((y == 1) && (x == BOARDSIZE - 1) && (tableCell(eng, x - 1, 1) == 'R') && (tableCell(eng, x - 2, 1) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->DIG; }
+				if ((y == 1) && (x == 2) && (tableCell(eng, x + 1, 1) == 'R') && (tableCell(eng, x + 2, 1) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->DIG; }
+				if ((y == BOARDSIZE) && (x == BOARDSIZE - 1) && (tableCell(eng, x - 1, BOARDSIZE) == 'R') && (tableCell(eng, x - 2, BOARDSIZE) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->DIG; }
+				if ((y == BOARDSIZE) && (x == 2) && (tableCell(eng, x + 1, BOARDSIZE) == 'R') && (tableCell(eng, x + 2, BOARDSIZE) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->DIG; }
+				if ((x == 1) && (y == BOARDSIZE - 1) && (tableCell(eng, 1, y - 1) == 'R') && (tableCell(eng, 1, y - 2) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->DIG; }
+				if ((x == 1) && (y == 2) && (tableCell(eng, 1, y + 1) == 'R') && (tableCell(eng, 1, y + 2) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->DIG; }
+				if ((x == BOARDSIZE) && (y == BOARDSIZE - 1) && (tableCell(eng, BOARDSIZE, y - 1) == 'R') && (tableCell(eng, BOARDSIZE, y - 2) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->DIG; }
+				if ((x == BOARDSIZE) && (y == 2) && (tableCell(eng, BOARDSIZE, y + 1) == 'R') && (tableCell(eng, BOARDSIZE, y + 2) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->DIG; }
 
 				// Favour positions in the quadrant of a corner you have already captured.
-				if ((x <= 3) && (y <= 3) && (gameTable[1][1] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + JIN; }
-				if ((x >= 5) && (y >= 5) && (gameTable[8][8] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + JIN; }
-				if ((x <= 3) && (y <= 5) && (gameTable[1][8] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + JIN; }
-				if ((x >= 5) && (y <= 3) && (gameTable[8][1] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + JIN; }
+				if ((x <= 3) && (y <= 3) && (tableCell(eng, 1, 1) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->JIN; }
+				if ((x >= BOARDSIZE - 3) && (y >= BOARDSIZE - 3) && (tableCell(eng, BOARDSIZE, BOARDSIZE) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->JIN; }
+				if ((x <= 3) && (y <= BOARDSIZE - 3) && (tableCell(eng, 1, BOARDSIZE) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->JIN; }
+				if ((x >= BOARDSIZE - 3) && (y <= 3) && (tableCell(eng, BOARDSIZE, 1) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->JIN; }
 
 				// Favour positions that are already surrounded by the opponent.
-				if ((gameTable[x - 1][y] == 'R') && (gameTable[x + 1][y] == 'R')) { validMoves[moveN].score = validMoves[moveN].score + BTW; }
-				if ((gameTable[x][y - 1] == 'R') && (gameTable[x][y + 1] == 'R')) { validMoves[moveN].score = validMoves[moveN].score + BTW; }
-				if ((gameTable[x - 1][y - 1] == 'R') && (gameTable[x + 1][y + 1] == 'R')) { validMoves[moveN].score = validMoves[moveN].score + BTW; }
-				if ((gameTable[x + 1][y - 1] == 'R') && (gameTable[x - 1][y + 1] == 'R')) { validMoves[moveN].score = validMoves[moveN].score + BTW; }
+				if ((tableCell(eng, x - 1, y) == 'R') && (tableCell(eng, x + 1, y) == 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->BTW; }
+				if ((tableCell(eng, x, y - 1) == 'R') && (tableCell(eng, x, y + 1) == 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->BTW; }
+				if ((tableCell(eng, x - 1, y - 1) == 'R') && (tableCell(eng, x + 1, y + 1) == 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->BTW; }
+				if ((tableCell(eng, x + 1, y - 1) == 'R') && (tableCell(eng, x - 1, y + 1) == 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->BTW; }
 
 				// Favour positions that are already surrounded by the opponent. Especially favour surrounded positions on an edge.
-				if ((y == 1) && (gameTable[x - 1][1] == 'R') && (gameTable[x + 1][1] == 'R')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((x == 1) && (gameTable[1][y - 1] == 'R') && (gameTable[1][y + 1] == 'R')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((y == 8) && (gameTable[x - 1][8] == 'R') && (gameTable[x + 1][8] == 'R')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
-				if ((x == 8) && (gameTable[8][y - 1] == 'R') && (gameTable[8][y + 1] == 'R')) { validMoves[moveN].score = validMoves[moveN].score + EDG; }
+				if ((y == 1) && (tableCell(eng, x - 1, 1) == 'R') && (tableCell(eng, x + 1, 1) == 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((x == 1) && (tableCell(eng, 1, y - 1) == 'R') && (tableCell(eng, 1, y + 1) == 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((y == BOARDSIZE) && (tableCell(eng, x - 1, BOARDSIZE) == 'R') && (tableCell(eng, x + 1, BOARDSIZE) == 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
+				if ((x == BOARDSIZE) && (tableCell(eng, BOARDSIZE, y - 1) == 'R') && (tableCell(eng, BOARDSIZE, y + 1) == 'R')) { validMoves[moveN].score = validMoves[moveN].score + w->EDG; }
 
 				// Favour positions that are already surrounded by your own pieces.
-				if ((gameTable[x - 1][y] == 'G') && (gameTable[x + 1][y] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + BTO; }
-				if ((gameTable[x][y - 1] == 'G') && (gameTable[x][y + 1] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + BTO; }
-				if ((gameTable[x - 1][y - 1] == 'G') && (gameTable[x + 1][y + 1] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + BTO; }
-				if ((gameTable[x + 1][y - 1] == 'G') && (gameTable[x - 1][y + 1] == 'G')) { validMoves[moveN].score = validMoves[moveN].score + BTO; }
+				if ((tableCell(eng, x - 1, y) == 'G') && (tableCell(eng, x + 1, y) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->BTO; }
+				if ((tableCell(eng, x, y - 1) == 'G') && (tableCell(eng, x, y + 1) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->BTO; }
+				if ((tableCell(eng, x - 1, y - 1) == 'G') && (tableCell(eng, x + 1, y + 1) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->BTO; }
+				if ((tableCell(eng, x + 1, y - 1) == 'G') && (tableCell(eng, x - 1, y + 1) == 'G')) { validMoves[moveN].score = validMoves[moveN].score + w->BTO; }
 
 				// Try out the move to see if it lets the opponent get a corner. If it does reduce the score for that move.
 				// While doing this also check if it increases the chance for the computer to get a corner later on.
-				tableToWorking();					// Copy the current game to the working table for processing.	
-				clearValidWorking();				// Clear valid moves as these will get in the way of working out best move.
-				workingTable[x][y] = 'G';			// Try the move in the working table.
-				captureRedWork(x, y, workingTable);	// Capture the pieces on the working table.
+				makeMove(&working, SQUARE(x, y));		// Try the move in the working position, red is then to move.
 
 				// The captured pieces were counted and used as part of the score. However, removing this improved the computer play.
 				// As pieces can be flipped back, going for the most flips is rarely the best move.
 
-				// The best way to capture a corner is to flip a diagonal piece as this allows capturing part of a diagonal including a corner.
-				if ((gameTable[1][1] == ' ') && ((gameTable[3][3] == 'g') || (gameTable[4][4] == 'g') || (gameTable[5][5] == 'g') || (gameTable[6][6] == 'g'))) 
-					{ validMoves[moveN].score = validMoves[moveN].score + CN2; }
-				if ((gameTable[8][8] == ' ') && ((gameTable[3][3] == 'g') || (gameTable[4][4] == 'g') || (gameTable[5][5] == 'g') || (gameTable[6][6] == 'g')))
-					{ validMoves[moveN].score = validMoves[moveN].score + CN2; }
-				if ((gameTable[1][8] == ' ') && ((gameTable[6][3] == 'g') || (gameTable[5][4] == 'g') || (gameTable[4][5] == 'g') || (gameTable[3][6] == 'g')))
-					{ validMoves[moveN].score = validMoves[moveN].score + CN2; }
-				if ((gameTable[8][1] == ' ') && ((gameTable[6][3] == 'g') || (gameTable[5][4] == 'g') || (gameTable[4][5] == 'g') || (gameTable[3][6] == 'g')))
-					{ validMoves[moveN].score = validMoves[moveN].score + CN2; }
-
-				clearFlips();	// Clear flips now they have been counted, so that the don't impact opponent valid move processing.
-				validRedMovesWork(workingTable);	// See what valid moves this gives to the opponent.
+				oppMoves = getMoves(working.pos.own, working.pos.opp);	// See what valid moves this gives to the opponent.
 				// If the move means the opponent can get a corner, reduce the score.
-				if (workingTable[1][1] == 'V') { validMoves[moveN].score = validMoves[moveN].score + CNO; }
-				if (workingTable[1][8] == 'V') { validMoves[moveN].score = validMoves[moveN].score + CNO; }
-				if (workingTable[8][1] == 'V') { validMoves[moveN].score = validMoves[moveN].score + CNO; }
-				if (workingTable[8][8] == 'V') { validMoves[moveN].score = validMoves[moveN].score + CNO; }
+				validMoves[moveN].score = validMoves[moveN].score + (w->CNO * bitCount(oppMoves & corners));
 
 				// Count up the valid moves this gives to the opponent and subtract it from the score, the more valid moves the opponent has, the more options they have.
-				vcnt = 0;
-				for (int xi = 1; xi <= 8; xi++)
-				{
-					for (int yi = 1; yi <= 8; yi++)
-					{
-						if (workingTable[xi][yi] == 'V') { vcnt++; }
-					}
-				}
+				vcnt = bitCount(oppMoves);
 				validMoves[moveN].score = validMoves[moveN].score - vcnt;
 
-				clearValidWorking();				// Clear the possible red moves to check the possible green moves.
-				validGreenMovesWork(workingTable);	// See what valid moves this gives us.
+				ownMoves = getMoves(working.pos.opp, working.pos.own);	// See what valid moves this gives us.
 				// If the move means that we have a chance to capture a corner increase the score.
-				if (workingTable[1][1] == 'V') { validMoves[moveN].score = validMoves[moveN].score + CN2; }
-				if (workingTable[1][8] == 'V') { validMoves[moveN].score = validMoves[moveN].score + CN2; }
-				if (workingTable[8][1] == 'V') { validMoves[moveN].score = validMoves[moveN].score + CN2; }
-				if (workingTable[8][8] == 'V') { validMoves[moveN].score = validMoves[moveN].score + CN2; }
+				validMoves[moveN].score = validMoves[moveN].score + (w->CN2 * bitCount(ownMoves & corners));
+
+				unmakeMove(&working);					// Take the move back ready to try the next one.
 
 				moveN++;	// Go on to the next valid move.
 			}
 		}
 	}
 
-	// Now that all valid moves have been analysed, select the valid move with the highest score.
-	captN = -100;
+	// Now that all valid moves have been analysed, put them in order of score, highest first.
 	for (unsigned int a = 0; a < moveN; a++)
 	{
-		if (validMoves[a].score > captN)
-		{
-			captN = validMoves[a].score;
-			selN = a;
-		}
-	}
+		unsigned int b = a;
 
-	// Depending on difficuty level replace the calculated move with a random move.
-	if (difficulty == EASY)			// Replace the move with a random move on a 50% chance.
-	{
-		if ((rand() % 2) == 0) { selN = rand() % moveN; }
+		for (; (b > 0) && (validMoves[a].score > validMoves[order[b - 1]].score); b--) { order[b] = order[b - 1]; }
+		order[b] = a;
 	}
-	else if (difficulty == MEDIUM)	// Replace the move with a random move on a 20% chance.
-	{
-		if ((rand() % 5) == 0) { selN = rand() % moveN; }
-	}
-	// For HARD the computer calculated move is always used.
+	for (unsigned int a = 0; a < moveN; a++) { order[a] = SQUARE(validMoves[order[a]].x, validMoves[order[a]].y); }
+
+	// Search ahead to find the best move, to the depth or for the time allowed by the difficulty level.
+	// The moves are searched in score order, so of moves the search finds equally good the one with the highest score is played.
+	eval.corner = w->COR;
+	eval.xSquare = w->XSQ;
+	eval.cSquare = w->CSQ;
+	eval.mobility = w->MOB;
+	eval.potential = w->POT;
+	limits.eval = &eval;
+	searchPosition(&eng->position, order, moveN, &limits, &eng->hash, &result);
+	return result.move;
+}
+
+// Calculate the computer move and play it. The pieces flipped by the move are returned.
+bitboard_t computerMove(engine_t* eng)
+{
+	int move = chooseMove(eng);
 
 	// Play the selected valid move.
-	clearValid();	// Get rid of potential move markers now move has been chosen.
-	gameTable[validMoves[selN].x][validMoves[selN].y] = 'G';	// Play the selected move.
-	captureRed(validMoves[selN].x, validMoves[selN].y);			// Capture the pieces.
-	return;
+	clearValid(eng);	// Get rid of potential move markers now move has been chosen.
+	return captureRed(eng, SQUAREX(move), SQUAREY(move));	// Play the selected move and capture the pieces.
 }
 
-#ifdef PLAYSELF	// Only needed for Optimisation.
-// Dummy human move to replace the player move to support optimisation.
-// This function favours edges and corners, but otherwise plays randomly.
-void putMoveDev(void)
+// Thread to choose the computer move, it flags when the move is ready to be played.
+static void moveThread(void* arg)
 {
-	validMove_t validMoves[60];	// Array to store valid moves (60 is the maximum number of available spaces on the board at the start of the game).
-	unsigned int moveN = 0;		// Valid Move count.
-	unsigned int selN = 0;		// Selected valid move.
-	int captN = 0;				// Used to record the highest score to select the best move.
+	engine_t* eng = (engine_t*)arg;
 
-	// Go through the entire board looking for valid moves 'V's and log the board positions in the validMoves array.
-	// Note board positions are labelled 1-8 left to right and 1-8 top to bottom, 1,1 is top left.
-	for (unsigned int x = 1; x <= 8; x++)
-	{
-		for (unsigned int y = 1; y <= 8; y++)
-		{
-			// If a valid move is found capture the position.
-			if (gameTable[x][y] == 'V')
-			{
-				validMoves[moveN].x = x;
-				validMoves[moveN].y = y;
-				validMoves[moveN].score = rand() % 8;		// Add a random element so that the dummy player plays differently for each game.
+	lowerPriority();	// The search helpers started from here share the cores with the display.
+	eng->chosenMove = chooseMove(eng);
+	setFlag(&eng->moveReady);
+}
 
-				// If the valid move is on an edge then increase the score. 
-				if (x == 1) { validMoves[moveN].score = validMoves[moveN].score + 2; }
-				if (x == 8) { validMoves[moveN].score = validMoves[moveN].score + 2; }
-				if (y == 1) { validMoves[moveN].score = validMoves[moveN].score + 2; }
-				if (y == 8) { validMoves[moveN].score = validMoves[moveN].score + 2; }
+// Start choosing the computer move on its own thread. If the thread cannot be started (or there are no threads) the move
+// is chosen straight away instead.
+void startComputerMove(engine_t* eng)
+{
+	eng->moveReady = false;
+	eng->thinking = true;
+	if (!startThread(&eng->moveThread, 1, moveThread, eng))
+	{
+		eng->chosenMove = chooseMove(eng);
+		eng->moveReady = true;
+	}
+}
 
-				// If the valid move is one of the four corners increase score.
-				if ((x == 1) && (y == 1)) { validMoves[moveN].score = validMoves[moveN].score + 10; }
-				if ((x == 1) && (y == 8)) { validMoves[moveN].score = validMoves[moveN].score + 10; }
-				if ((x == 8) && (y == 1)) { validMoves[moveN].score = validMoves[moveN].score + 10; }
-				if ((x == 8) && (y == 8)) { validMoves[moveN].score = validMoves[moveN].score + 10; }
+// Once the move is ready, play it in the same way as computerMove.
+bool pollComputerMove(engine_t* eng, bitboard_t* flips)
+{
+	if (!eng->thinking || !readFlag(&eng->moveReady)) { return false; }
 
-				moveN++;	// Next valid move.
-			}
-		}
-	}
+	joinThread(&eng->moveThread);
+	eng->thinking = false;
+	clearValid(eng);	// Get rid of potential move markers now move has been chosen.
+	*flips = captureRed(eng, SQUAREX(eng->chosenMove), SQUAREY(eng->chosenMove));	// Play the selected move and capture the pieces.
+	return true;
+}
 
-	// Select the move based on the score.
-	for (unsigned int a = 0; a < moveN; a++)
-	{
-		if (validMoves[a].score > captN)
-		{
-			captN = validMoves[a].score;
-			selN = a;
-		}
-	}
+#ifdef PLAYSELF	// Only needed for Optimisation.
+// Dummy human move to replace the player move to support optimisation.
+// This function always takes a corner and favours edges, but otherwise plays randomly. The move is picked straight from the valid moves.
+void putMoveDev(engine_t* eng)
+{
+	int sq = weightedRandomMove(eng->valid, &eng->rng);
 
 	// Play the selected valid move.
-	clearValid();	// Get rid of potential move markers now move has been chosen.
-	gameTable[validMoves[selN].x][validMoves[selN].y] = 'R';	// Add the move.
-	captureGreen(validMoves[selN].x, validMoves[selN].y);		// Capture the pieces.
+	clearValid(eng);	// Get rid of potential move markers now move has been chosen.
+	captureGreen(eng, SQUAREX(sq), SQUAREY(sq));	// Add the move and capture the pieces.
 	return;
 }
 
 // This is a version of the game play loop from the main program, that plays the computer player against the dummy human player many times.
 // The score weightings are randomly tweaked each time and played against the dummy human player. If the number of games lost reduces, the new weightings are retained.
 // In this way the computer move calculations are optimised to lose the fewest games (ideally none).
-void Optimise(void)
+void Optimise(engine_t* eng)
 {
 	unsigned int red = 2, green = 2;	// Counts for how many pieces each player has.
 	float rWin = 0.0f, gWin = 0.0f;		// Counts for each player game wins. Floating point is used so that draws can be awarded as 0.5 each.
+	float losses = 300.0f;				// Count to check how many games lost in optimisation run.
+	weights_t* w = &eng->weights;		// Weightings being tried out.
 
 	// Local copies of the calculation constants to keep the best values found by optimisation.
 	int EDGb, EG2b, CNRb, CNOb, CN2b, NCNb, JINb, BTWb, BTOb, DIGb;
+	int CORb, XSQb, CSQb, MOBb, POTb;
 
-	clearGameTable();	// Set up the game table.
+	clearGameTable(eng);	// Set up the game table.
 
 	// Set best to match starting values before optimisation.
-	EDGb = EDG;
-	EG2b = EG2;
-	CNRb = CNR;
-	CNOb = CNO;
-	CN2b = CN2;
-	NCNb = NCN;
-	JINb = JIN;
-	BTWb = BTW;
-	BTOb = BTO;
-	DIGb = DIG;
+	EDGb = w->EDG;
+	EG2b = w->EG2;
+	CNRb = w->CNR;
+	CNOb = w->CNO;
+	CN2b = w->CN2;
+	NCNb = w->NCN;
+	JINb = w->JIN;
+	BTWb = w->BTW;
+	BTOb = w->BTO;
+	DIGb = w->DIG;
+	CORb = w->COR;
+	XSQb = w->XSQ;
+	CSQb = w->CSQ;
+	MOBb = w->MOB;
+	POTb = w->POT;
 
 	// Check the board to get the pieces counts before the first display.
-	checkBoard('R', &red, &green);
+	checkBoard(eng, 'R', &red, &green);
 
 	for (int a = 0; a < 1000; a++)	// Try many different variations of the weightings.
 	{
@@ -325,28 +329,28 @@ void Optimise(void)
 		{
 			for (;;)	// Play with player first until game over.
 			{
-				validRedMoves();	// Identify all of the valid moves that the human player can make.
+				validRedMoves(eng);	// Identify all of the valid moves that the human player can make.
 
 				// If there are valid moves available to the player get their move.
-				if (checkBoard('R', &red, &green) != 'M')
+				if (checkBoard(eng, 'R', &red, &green) != 'M')
 				{
-					putMoveDev();	// Used for computer to play self to build database.
+					putMoveDev(eng);	// Used for computer to play self to build database.
 				}
 
-				checkBoard('G', &red, &green);	// Check the board to get the pieces counts before display.
+				checkBoard(eng, 'G', &red, &green);	// Check the board to get the pieces counts before display.
 
 				// Check if the game is over.
-				if (checkBoard('B', &red, &green) != ' ') { break; }
+				if (checkBoard(eng, 'B', &red, &green) != ' ') { break; }
 
-				validGreenMoves();	// Identify the valid moves for the computer.
+				validGreenMoves(eng);	// Identify the valid moves for the computer.
 
 				// If there are valid moves available to the computer get their move.
-				if (checkBoard('G', &red, &green) != 'M') { computerMove(); }
+				if (checkBoard(eng, 'G', &red, &green) != 'M') { computerMove(eng); }
 
-				checkBoard('R', &red, &green); // Check the board to get the pieces counts before display.
+				checkBoard(eng, 'R', &red, &green); // Check the board to get the pieces counts before display.
 
 				// Check if the game is over.
-				if (checkBoard('B', &red, &green) != ' ') { break; }
+				if (checkBoard(eng, 'B', &red, &green) != ' ') { break; }
 			}
 
 			// Work out who won and update the score count.
@@ -354,36 +358,36 @@ void Optimise(void)
 			else if (red < green) { gWin = gWin + 1.0f; }
 			else { rWin = rWin + 0.5f; gWin = gWin + 0.5f; }	// Need to consider the players can draw.
 
-			clearGameTable();	// Set up the game table.
+			clearGameTable(eng);	// Set up the game table.
 
 			// Check the board to get the pieces counts before the first display.
-			checkBoard('G', &red, &green);
+			checkBoard(eng, 'G', &red, &green);
 
 			for (;;)	// Play with computer first until game over.
 			{
-				validGreenMoves();	// Identify all of the valid moves for the computer.
+				validGreenMoves(eng);	// Identify all of the valid moves for the computer.
 
 				// If there are valid moves available to the computer get their move.
-				if (checkBoard('G', &red, &green) != 'M') { computerMove(); }
+				if (checkBoard(eng, 'G', &red, &green) != 'M') { computerMove(eng); }
 
-				checkBoard('R', &red, &green);	// Check the board to get the pieces counts before display.
+				checkBoard(eng, 'R', &red, &green);	// Check the board to get the pieces counts before display.
 
 				// Check if the game is over.
-				if (checkBoard('B', &red, &green) != ' ') { break; }
+				if (checkBoard(eng, 'B', &red, &green) != ' ') { break; }
 
-				validRedMoves();	// Identify the valid moves for the player.
+				validRedMoves(eng);	// Identify the valid moves for the player.
 
 				// If there are valid moves available to the player get their move.
-				if (checkBoard('G', &red, &green) != 'M')
+				if (checkBoard(eng, 'G', &red, &green) != 'M')
 				{
-					putMoveDev();	// Used for computer to play self to build database.
+					putMoveDev(eng);	// Used for computer to play self to build database.
 				}
 
 				// Check if the game is over.
-				checkBoard('G', &red, &green);	// Check the b7 4oard to get the pieces counts before display.
+				checkBoard(eng, 'G', &red, &green);	// Check the b7 4oard to get the pieces counts before display.
 
 				// Check if the game is over.
-				if (checkBoard('B', &red, &green) != ' ') { break; }
+				if (checkBoard(eng, 'B', &red, &green) != ' ') { break; }
 			}
 
 			// Work out who won and update the score count.
@@ -391,10 +395,10 @@ void Optimise(void)
 			else if (red < green) { gWin = gWin + 1.0f; }
 			else { rWin = rWin + 0.5f; gWin = gWin + 0.5f; }	// Need to consider the players can draw.
 
-			clearGameTable();	// Set up the game table.
+			clearGameTable(eng);	// Set up the game table.
 
 			// Check the board to get the pieces counts before the first display.
-			checkBoard('R', &red, &green);
+			checkBoard(eng, 'R', &red, &green);
 		}
 
 		std::cout << "Red Wins: " << rWin << " Green Wins: " << gWin << "\n";	// Display number of wins.
@@ -403,45 +407,63 @@ void Optimise(void)
 		if (rWin < (losses * 0.95))
 		{
 			// Set best to match current values;
-			EDGb = EDG;
-			EG2b = EG2;
-			CNRb = CNR;
-			CNOb = CNO;
-			CN2b = CN2;
-			NCNb = NCN;
-			JINb = JIN;
-			BTWb = BTW;
-			BTOb = BTO;
-			DIGb = DIG;
-			std::cout << "EDG: " << EDG << " EG2: " << EG2 << " CNR: " << CNR << " CNO: " << CNO << " CN2: " << CN2 << " NCN: " << NCN << " JIN: " << JIN << " BTW: " << BTW << " BTO: " << BTO << " DIG: " << DIG << "\n";	// Display weightings.
+			EDGb = w->EDG;
+			EG2b = w->EG2;
+			CNRb = w->CNR;
+			CNOb = w->CNO;
+			CN2b = w->CN2;
+			NCNb = w->NCN;
+			JINb = w->JIN;
+			BTWb = w->BTW;
+			BTOb = w->BTO;
+			DIGb = w->DIG;
+			CORb = w->COR;
+			XSQb = w->XSQ;
+			CSQb = w->CSQ;
+			MOBb = w->MOB;
+			POTb = w->POT;
+			std::cout << "EDG: " << w->EDG << " EG2: " << w->EG2 << " CNR: " << w->CNR << " CNO: " << w->CNO << " CN2: " << w->CN2 << " NCN: " << w->NCN << " JIN: " << w->JIN << " BTW: " << w->BTW << " BTO: " << w->BTO << " DIG: " << w->DIG << "\n";	// Display weightings.
+			std::cout << "COR: " << w->COR << " XSQ: " << w->XSQ << " CSQ: " << w->CSQ << " MOB: " << w->MOB << " POT: " << w->POT << "\n";
 
 			// Set the new expectation for losses, ready to test the next set of weightings.
 			losses = rWin;
 		}
 
 		// Set the current settings back to the best values (for the case where the trial weightings were worse than the best).
-		EDG = EDGb;
-		EG2 = EG2b;
-		CNR = CNRb;
-		CNO = CNOb;
-		CN2 = CN2b;
-		NCN = NCNb;
-		JIN = JINb;
-		BTW = BTWb;
-		BTO = BTOb;
-		DIG = DIGb;
+		w->EDG = EDGb;
+		w->EG2 = EG2b;
+		w->CNR = CNRb;
+		w->CNO = CNOb;
+		w->CN2 = CN2b;
+		w->NCN = NCNb;
+		w->JIN = JINb;
+		w->BTW = BTWb;
+		w->BTO = BTOb;
+		w->DIG = DIGb;
+		w->COR = CORb;
+		w->XSQ = XSQb;
+		w->CSQ = CSQb;
+		w->MOB = MOBb;
+		w->POT = POTb;
 
 		// Randomly tweak some of the values to trial these against the dummy human player.
-		if ((rand() % 5) == 0) { EDG = EDGb + (rand() % 7) - 3; }
-		if ((rand() % 5) == 0) { EG2 = EG2b + (rand() % 7) - 3; }
-		if ((rand() % 5) == 0) { CNR = CNRb + (rand() % 7) - 3; }
-		if ((rand() % 5) == 0) { CNO = CNOb + (rand() % 7) - 3; }
-		if ((rand() % 5) == 0) { CN2 = CN2b + (rand() % 7) - 3; }
-		if ((rand() % 5) == 0) { NCN = NCNb + (rand() % 7) - 3; }
-		if ((rand() % 5) == 0) { JIN = JINb + (rand() % 7) - 3; }
-		if ((rand() % 5) == 0) { BTW = BTWb + (rand() % 7) - 3; }
-		if ((rand() % 5) == 0) { BTO = BTOb + (rand() % 7) - 3; }
-		if ((rand() % 5) == 0) { DIG = DIGb + (rand() % 7) - 3; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->EDG = EDGb + (randomBelow(&eng->rng, 7)) - 3; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->EG2 = EG2b + (randomBelow(&eng->rng, 7)) - 3; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->CNR = CNRb + (randomBelow(&eng->rng, 7)) - 3; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->CNO = CNOb + (randomBelow(&eng->rng, 7)) - 3; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->CN2 = CN2b + (randomBelow(&eng->rng, 7)) - 3; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->NCN = NCNb + (randomBelow(&eng->rng, 7)) - 3; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->JIN = JINb + (randomBelow(&eng->rng, 7)) - 3; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->BTW = BTWb + (randomBelow(&eng->rng, 7)) - 3; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->BTO = BTOb + (randomBelow(&eng->rng, 7)) - 3; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->DIG = DIGb + (randomBelow(&eng->rng, 7)) - 3; }
+
+		// The evaluation weightings are in hundredths of a disc, so they are tweaked in bigger steps.
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->COR = CORb + (randomBelow(&eng->rng, 41)) - 20; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->XSQ = XSQb + (randomBelow(&eng->rng, 41)) - 20; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->CSQ = CSQb + (randomBelow(&eng->rng, 41)) - 20; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->MOB = MOBb + (randomBelow(&eng->rng, 41)) - 20; }
+		if ((randomBelow(&eng->rng, 5)) == 0) { w->POT = POTb + (randomBelow(&eng->rng, 41)) - 20; }
 
 		// Clean the win counts ready for next optimisation run.
 		rWin = 0.0f;
@@ -449,6 +471,7 @@ void Optimise(void)
 	}
 	// Show the final weightings after optimisation.
 	std::cout << "EDG: " << EDGb << " EG2: " << EG2b << " CNR: " << CNRb << " CNO: " << CNOb << " CN2: " << CN2b << " NCN: " << NCNb << " JIN: " << JINb << " BTW: " << BTWb << " BTO: " << BTOb << " DIG: " << DIGb << "\n";	// Display weightings.
+	std::cout << "COR: " << CORb << " XSQ: " << XSQb << " CSQ: " << CSQb << " MOB: " << MOBb << " POT: " << POTb << "\n";
 }
 #endif
 
@@ -10,20 +10,16 @@
 //************************************************************************************************************************
 #pragma once
 
-enum difficulty_e { EASY, MEDIUM, HARD };						// Difficulty levels.
+#include "Game.h"					// Game API and engine data.
 
-extern enum difficulty_e difficulty;
+extern const weights_t defaultWeights;	// Starting weightings for the computer move (the best found by optimisation so far).
 
-// Global data and functions from Game.c that are needed for computer move, but are not made available for the main game program.
-extern char gameTable[10][10];									// Main game table.
-extern char	workingTable[10][10];								// Working copy of game table.
+// Functions from Game.c that are needed for computer move, but are not made available for the main game program.
+extern char tableCell(const engine_t* eng, int x, int y);		// Get the character for a square of the game table, 'B' for positions off the board.
+extern void clearValid(engine_t* eng);							// Get rid of potential move markers now move has been chosen.
+extern bitboard_t captureRed(engine_t* eng, int xi, int yi);	// Green plays the move and returns the red pieces flipped.
+extern bitboard_t captureGreen(engine_t* eng, int xi, int yi);	// Red plays the move and returns the green pieces flipped.
 
-extern void tableToWorking(void);								// Copy the current game board to a working copy for more detailed processing.
-extern void clearFlips(void);									// Clear any lower case used to indicate flipped pieces.
-extern void clearValid(void);									// Get rid of potential move markers now move has been chosen.
-extern void clearValidWorking(void);							// Clear valid moves as these will get in the way of working out best move.
-extern void captureRed(int xi, int yi);							// Capture the red pieces to be flipped.
-extern void captureGreen(int xi, int yi);						// Capture the green pieces to be flipped.
-extern void captureRedWork(int xi, int yi, char table[10][10]);	// Capture the pieces on the working table on the chosen table.
-extern void validGreenMovesWork(char table[10][10]);			// Work out which moves green can do, on the chosen table.
-extern void validRedMovesWork(char table[10][10]);				// Work out which moves red can do, on the chosen table.
+#ifdef PLAYSELF
+void Optimise(engine_t* eng);									// Play the computer against a dummy player many times to tune the weightings.
+#endif
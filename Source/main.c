@@ -22,7 +22,8 @@
 #include "Images/Images.h"		// For the images to be drawn using Draw.h.
 #include "Sounds.h"				// For sounds and background music.
 #include "Game.h"				// For Othello Game API.
-#include "computerMove.h"		// To gain access to the difficulty constant to change difficulty level.
+
+#define NOSELECTION (NSQUARES - 4)	// Entry of vMoves never filled in, so x and y are 0 and the selection is not displayed.
 
 enum gameState_e { SETUP, PLAYERMOVE, PANIMATE, WIIUMOVE, WANIMATE, NEWGAME };	// State machine to control game play.
 enum messageState_e { NOMESSAGE, SKIPTURN, REDWIN, GREENWIN, DRAWGAME };		// Messages to be displayed to player.
@@ -33,7 +34,9 @@ struct vMove					// Valid move data type showing position.
 	unsigned int x;	// x position on board 1-8 left to right.
 	unsigned int y;	// y position on board 1-8 top to bottom.
 };
-vMove_t vMoves[60];	// Array of possible valid moves. This is set to the available spaces at the start of the game, so it will always be enough.
+vMove_t vMoves[NSQUARES - 3];	// Array of possible valid moves. There can be no more than the spaces at the start of the game, with one more always left at 0.
+
+engine_t game;						// The game being played, passed to each of the Game API functions.
 
 // Globals to control game operation.
 enum gameState_e gameState;			// State to control operation of play.
@@ -43,6 +46,7 @@ int nmoves = 0;						// Number of valid moves at this turn.
 int selMove = 0;					// Move selected by the player.
 unsigned int red = 0, green = 0;	// Counts for how many pieces each player has.
 float rWin = 0.0f, gWin = 0.0f;		// Counts for each player game wins. Floating point is used so that draws can be awarded as 0.5 each.
+bitboard_t flips = 0;				// Pieces flipped by the last move, so that they can be animated.
 
 void drawBorder()
 {
@@ -93,43 +97,42 @@ void displayTV()
 	if (messageState == DRAWGAME) { drawText("DRAW\0", 0xFEFEFE00, 3, 20, 300, SCREEN_TV); }
 
 	// Show the Othello game board.
-	for (int x = 1; x <= 8; x++)
+	for (int x = 1; x <= BOARDSIZE; x++)
 	{
-		for (int y = 1; y <= 8; y++)
+		for (int y = 1; y <= BOARDSIZE; y++)
 		{
 			// Put the correct sprite on the screen for the state of that space in the game board.
-			if (getGameTable(x, y) == ' ') { drawImage(BLKSIZE, BLKSIZE, BlankImage, ((x - 1) * BLKSIZE), ((y -1) * BLKSIZE)); }
-			if (getGameTable(x, y) == 'V') { drawImage(BLKSIZE, BLKSIZE, AllowedImage, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if (getGameTable(x, y) == 'R') { drawImage(BLKSIZE, BLKSIZE, Red5Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if (getGameTable(x, y) == 'G') { drawImage(BLKSIZE, BLKSIZE, Green1Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-
-			// This is a fiddle using global variable to animate pieces flipping. 
-			// It isn't all that maintainable, but it works and shouldn't need to change.
-			if  (getGameTable(x, y) == 'r') { drawImage(BLKSIZE, BLKSIZE, Red5Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }	// If not animating show as a red piece.
-			if ((getGameTable(x, y) == 'r') && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Green1Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'r') && (stateCnt ==  3) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Green2Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'r') && (stateCnt ==  4) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Green3Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'r') && (stateCnt ==  5) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Green4Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'r') && (stateCnt ==  6) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Green5Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'r') && (stateCnt ==  7) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, MiddleImage, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'r') && (stateCnt ==  8) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Red1Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'r') && (stateCnt ==  9) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Red2Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'r') && (stateCnt == 10) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Red3Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'r') && (stateCnt == 11) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Red4Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'r') && (stateCnt >= 12) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Red5Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-
-			if  (getGameTable(x, y) == 'g') { drawImage(BLKSIZE, BLKSIZE, Green1Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }	// If not animating show as a green piece.
-			if ((getGameTable(x, y) == 'g') && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Red5Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'g') && (stateCnt == 22) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Red4Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'g') && (stateCnt == 23) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Red3Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'g') && (stateCnt == 24) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Red2Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'g') && (stateCnt == 25) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Red1Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'g') && (stateCnt == 26) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, MiddleImage, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'g') && (stateCnt == 27) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Green5Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'g') && (stateCnt == 28) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Green4Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'g') && (stateCnt == 29) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Green3Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'g') && (stateCnt == 30) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Green2Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
-			if ((getGameTable(x, y) == 'g') && (stateCnt >= 31) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Green1Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (getGameTable(&game, x, y) == ' ') { drawImage(BLKSIZE, BLKSIZE, BlankImage, ((x - 1) * BLKSIZE), ((y -1) * BLKSIZE)); }
+			if (getGameTable(&game, x, y) == 'V') { drawImage(BLKSIZE, BLKSIZE, AllowedImage, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (getGameTable(&game, x, y) == 'R') { drawImage(BLKSIZE, BLKSIZE, Red5Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (getGameTable(&game, x, y) == 'G') { drawImage(BLKSIZE, BLKSIZE, Green1Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+
+			// Pieces flipped by the last move are animated turning over. The flips are kept separately from the game table.
+			bool flipped = ((flips & SQUAREBIT(SQUARE(x, y))) != 0);
+
+			if (flipped && (getGameTable(&game, x, y) == 'R') && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Green1Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'R') && (stateCnt ==  3) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Green2Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'R') && (stateCnt ==  4) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Green3Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'R') && (stateCnt ==  5) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Green4Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'R') && (stateCnt ==  6) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Green5Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'R') && (stateCnt ==  7) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, MiddleImage, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'R') && (stateCnt ==  8) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Red1Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'R') && (stateCnt ==  9) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Red2Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'R') && (stateCnt == 10) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Red3Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'R') && (stateCnt == 11) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Red4Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'R') && (stateCnt >= 12) && (gameState == PANIMATE)) { drawImage(BLKSIZE, BLKSIZE, Red5Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+
+			if (flipped && (getGameTable(&game, x, y) == 'G') && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Red5Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'G') && (stateCnt == 22) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Red4Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'G') && (stateCnt == 23) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Red3Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'G') && (stateCnt == 24) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Red2Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'G') && (stateCnt == 25) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Red1Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'G') && (stateCnt == 26) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, MiddleImage, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'G') && (stateCnt == 27) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Green5Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'G') && (stateCnt == 28) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Green4Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'G') && (stateCnt == 29) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Green3Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'G') && (stateCnt == 30) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Green2Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
+			if (flipped && (getGameTable(&game, x, y) == 'G') && (stateCnt >= 31) && (gameState == WIIUMOVE)) { drawImage(BLKSIZE, BLKSIZE, Green1Image, ((x - 1) * BLKSIZE), ((y - 1) * BLKSIZE)); }
 		}
 	}
 	// Superimpose the selected move onto the table (it is set off the screen when it is not to be displayed).
@@ -152,9 +155,9 @@ void displayGPad()
 	drawText("Play for as many red pieces as you can.\0", 0xFEFEFE00, 2, 10, 130, SCREEN_DRC);
 	drawText("Use the Joycon or direction buttons to select.\0", 0xFEFEFE00, 2, 10, 160, SCREEN_DRC);
 	drawText("Press A to make move.\0", 0xFEFEFE00, 2, 10, 190, SCREEN_DRC);
-	if (difficulty == EASY)   { drawText("EASY    Press ZL and ZR to change difficulty.\0", 0xFEFEFE00, 2, 10, 230, SCREEN_DRC); }
-	if (difficulty == MEDIUM) { drawText("MEDIUM  Press ZL and ZR to change difficulty.\0", 0xFEFEFE00, 2, 10, 230, SCREEN_DRC); }
-	if (difficulty == HARD)   { drawText("HARD    Press ZL and ZR to change difficulty.\0", 0xFEFEFE00, 2, 10, 230, SCREEN_DRC); }
+	if (game.difficulty == EASY)   { drawText("EASY    Press ZL and ZR to change difficulty.\0", 0xFEFEFE00, 2, 10, 230, SCREEN_DRC); }
+	if (game.difficulty == MEDIUM) { drawText("MEDIUM  Press ZL and ZR to change difficulty.\0", 0xFEFEFE00, 2, 10, 230, SCREEN_DRC); }
+	if (game.difficulty == HARD)   { drawText("HARD    Press ZL and ZR to change difficulty.\0", 0xFEFEFE00, 2, 10, 230, SCREEN_DRC); }
 
 	// Flip the screen buffer to show the new display.
 	OSScreenFlipBuffersEx(SCREEN_DRC);
@@ -165,11 +168,11 @@ void displayGPad()
 void findValidMoves(void)
 {
 	nmoves = 0;	// Number of valid moves found.
-	for (int x = 1; x <= 8; x++)
+	for (int x = 1; x <= BOARDSIZE; x++)
 	{
-		for (int y = 1; y <= 8; y++)
+		for (int y = 1; y <= BOARDSIZE; y++)
 		{
-			if (getGameTable(x, y) == 'V') { vMoves[nmoves].x = x; vMoves[nmoves].y = y; nmoves++; }
+			if (getGameTable(&game, x, y) == 'V') { vMoves[nmoves].x = x; vMoves[nmoves].y = y; nmoves++; }
 		}
 	}
 	selMove = nmoves - 1;	// Set the first valid move to the last valid move found.
@@ -199,14 +202,14 @@ bool humanMove(void)
 		// Play the selected move.
 		if (status.trigger & VPAD_BUTTON_A) 
 		{
-			putMove(vMoves[selMove].x, vMoves[selMove].y);
+			putMove(&game, vMoves[selMove].x, vMoves[selMove].y, &flips);
 			return true;
 		}
 		// If commanded change the level of difficulty,
 		if ((status.trigger & VPAD_BUTTON_ZL) && (status.trigger & VPAD_BUTTON_ZL))
 		{
-			difficulty++;
-			if (difficulty > HARD) { difficulty = EASY;  } // Wrap difficulty back to easy.
+			game.difficulty++;
+			if (game.difficulty > HARD) { game.difficulty = EASY;  } // Wrap difficulty back to easy.
 			gameState = SETUP;	// As difficulty changed, start a new game.
 		}
 	}
@@ -223,6 +226,7 @@ int main(int argc, char **argv)
     WHBLogConsoleInit();		// ConsoleInit seems to get the display to operate correctly so keep in the build.
 
 	setupSound();
+	initEngine(&game);			// Default difficulty and computer move weightings.
 
 	gameState = SETUP;			// Initial game state.
 	messageState = NOMESSAGE;	// No message to display at start of game.
@@ -234,9 +238,10 @@ int main(int argc, char **argv)
 
 		if (gameState == SETUP)
 		{
-			clearGameTable();				// Set up the game table.
-			checkBoard('R', &red, &green);	// Check the board to get the pieces counts before the first display.
-			validRedMoves();				// Identify all of the valid moves that the human player can make.
+			clearGameTable(&game);				// Set up the game table.
+			flips = 0;						// Nothing to animate at the start of a game.
+			checkBoard(&game, 'R', &red, &green);	// Check the board to get the pieces counts before the first display.
+			validRedMoves(&game);				// Identify all of the valid moves that the human player can make.
 			findValidMoves();				// Get list of valid moves to support human move.
 			gameState = PLAYERMOVE;			// Move on to the player move.
 			stateCnt = 0;					// Remember to re-start state count for each change of state.
@@ -244,12 +249,12 @@ int main(int argc, char **argv)
 		else if (gameState == PLAYERMOVE)
 		{
 			// Check if there is a valid move available.
-			if (checkBoard('R', &red, &green) != 'M')
+			if (checkBoard(&game, 'R', &red, &green) != 'M')
 			{
 				// If there are valid moves let the player select one.
 				if (humanMove() == true) 
 				{ 
-					selMove = 59;		// Setting the selected move to the end of the table means x and y are 0, so it is no longer displayed.
+					selMove = NOSELECTION;	// Setting the selected move to the unused entry means x and y are 0, so it is no longer displayed.
 					putsoundSel(MOVE);	// Make the move sound.
 					gameState = PANIMATE;
 					stateCnt = 0;		// Remember to re-start state count for each change of state.
@@ -258,7 +263,8 @@ int main(int argc, char **argv)
 			// Otherwise go to the computer move.
 			else
 			{
-				selMove = 59;				// Setting the selected move to the end of the table means x and y are 0, so it is no longer displayed.
+				selMove = NOSELECTION;		// Setting the selected move to the unused entry means x and y are 0, so it is no longer displayed.
+				flips = 0;					// No pieces flipped this turn.
 				putsoundSel(DRAW);			// Make the move sound.
 				gameState = PANIMATE;		// Move to on to animating the player move.
 				stateCnt = 0;				// Remember to re-start state count for each change of state.
@@ -267,11 +273,11 @@ int main(int argc, char **argv)
 		}
 		else if (gameState == PANIMATE)
 		{
-			// Allow time for animation to be seen, before doing checking which clears flips.
+			// Allow time for animation to be seen, before checking for the end of the game.
 			if (stateCnt == 20)
 			{
 				// Check if the game is over.
-				if (checkBoard('B', &red, &green) != ' ') 
+				if (checkBoard(&game, 'B', &red, &green) != ' ') 
 				{ 
 					gameState = NEWGAME; 
 					stateCnt = 0;			// Remember to re-start state count for each change of state.
@@ -281,7 +287,7 @@ int main(int argc, char **argv)
 			// Move on after time allowed to see move.
 			if (stateCnt >= 40) 
 			{ 
-				validGreenMoves();			// Identify the valid moves for the computer.
+				validGreenMoves(&game);			// Identify the valid moves for the computer.
 				gameState = WIIUMOVE;
 				stateCnt = 0;				// Remember to re-start state count for each change of state.
 			}
@@ -291,18 +297,26 @@ int main(int argc, char **argv)
 			// Check the move once allowing time for it to be seen.
 			if (stateCnt == 20)
 			{
-				// Check if there is a valid move available and make it
-				if (checkBoard('G', &red, &green) != 'M')
+				// Check if there is a valid move available and start working it out. The search runs on its own thread,
+				// so the display carries on while it does.
+				if (checkBoard(&game, 'G', &red, &green) != 'M')
 				{
-					computerMove();
-					putsoundSel(MOVE);	// Make the move sound.
+					flips = 0;			// Nothing to animate until the move is made.
+					startComputerMove(&game);
 				}
 				else  // Otherwise show the computer had to miss a go.
 				{
+					flips = 0;			// No pieces flipped this turn.
 					putsoundSel(DRAW);	// Make s skip turn sound.
 					messageState = SKIPTURN;
 				}
 			}
+			// Hold the state count while the computer is thinking, then make its move.
+			if (game.thinking)
+			{
+				if (pollComputerMove(&game, &flips)) { putsoundSel(MOVE); }	// Make the move sound.
+				else { stateCnt = 20; }
+			}
 			// Move on after allowing time for the player to see what is going on.
 			if (stateCnt > 40)
 			{
@@ -317,7 +331,7 @@ int main(int argc, char **argv)
 			if (stateCnt == 1)
 			{
 				// Check if the game is over.
-				if (checkBoard('B', &red, &green) != ' ')
+				if (checkBoard(&game, 'B', &red, &green) != ' ')
 				{
 					gameState = NEWGAME;
 					stateCnt = 0;		// Remember to re-start state count for each change of state.
@@ -326,7 +340,7 @@ int main(int argc, char **argv)
 			// Move on after allowing time for changes to be seen.
 			if (stateCnt > 20)
 			{
-				validRedMoves();	// Identify all of the valid moves that the human player can make.
+				validRedMoves(&game);	// Identify all of the valid moves that the human player can make.
 				findValidMoves();	// Get list of valid moves to support human move.
 				gameState = PLAYERMOVE;
 				stateCnt = 0;		// Remember to re-start state count for each change of state.
@@ -345,21 +359,22 @@ int main(int argc, char **argv)
 			// Move on after allowing time for sound to play.
 			if (stateCnt > 50)
 			{
-				clearGameTable();				// Set up the game table.
-				checkBoard('B', &red, &green);	// Check the board to get the pieces counts before the first display.
+				clearGameTable(&game);				// Set up the game table.
+				flips = 0;						// Nothing to animate at the start of a game.
+				checkBoard(&game, 'B', &red, &green);	// Check the board to get the pieces counts before the first display.
 				messageState = NOMESSAGE;		// Clear any messages.
 
 				// Even games have human first, odd games have computer first.
 				if ((((int)(rWin + gWin + 0.05f)) % 2) == 0)
 				{
-					validRedMoves();				// Identify all of the valid moves that the human player can make.
+					validRedMoves(&game);				// Identify all of the valid moves that the human player can make.
 					findValidMoves();				// Get list of valid moves to support human move.
 					gameState = PLAYERMOVE;			// Human player first.
 					stateCnt = 0;					// Remember to re-start state count for each change of state.
 				}
 				else
 				{
-					validGreenMoves();				// Identify the valid moves for the computer.
+					validGreenMoves(&game);				// Identify the valid moves for the computer.
 					gameState = WIIUMOVE;			// Computer first.
 					stateCnt = 0;					// Remember to re-start state count for each change of state.
 				}
@@ -381,6 +396,7 @@ int main(int argc, char **argv)
 		OSSleepTicks(OSMillisecondsToTicks(del));	// Delay to keep game operating at the same screen update.
 	}
 
+	freeEngine(&game);							// Free the transposition table.
 	QuitSound();
 
 	// If we get out of the program clean up and exit.
@@ -0,0 +1,164 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Analyse
+//*
+//* Host program that runs the computer move search over a fixed set of positions from random games, to measure how
+//* fast it is and how well the moves are ordered. The same positions are used every time, so changes to the search can
+//* be compared by the number of positions searched and the time taken.
+//*
+//* Usage: analyse [depth] [-n positions] [-h hashMB] [-e empties] [-t threads] [-m method]
+//*   The method is alpha-beta, pvs, aspiration, pvs+aspiration, mtdf or probcut (pvs, aspiration and probcut, the
+//*   default), or all to compare them.
+//*   The solve methods play every line out to the end of the game with the endgame solver (the depth is not used): solve
+//*   for the exact score, solve+mtdf for the exact score with MTD(f), or wld for only win, loss or draw. They are not part
+//*   of all as they are only practical with -e.
+//*
+//************************************************************************************************************************
+#include <stdio.h>			// For printf.
+#include <stdlib.h>			// For atoi.
+#include <string.h>			// For strcmp.
+
+#include "Search.h"			// Computer move search.
+#include "Playout.h"		// Random moves for the test positions.
+
+#define MAXPOSITIONS 1000	// Most positions in the test set.
+
+position_t positions[MAXPOSITIONS];	// Test set of positions.
+
+// Fill the test set with positions from a third to two thirds of the way through random games, or with the number
+// of empty squares if that is given.
+static void makePositions(int n, int empties)
+{
+	rng_t rng;
+
+	seedRandom(&rng, 2025);
+	for (int a = 0; a < n; a++)
+	{
+		position_t pos;
+		int plies = ((NSQUARES - 4) / 3) + (int)randomBelow(&rng, (NSQUARES - 4) / 3);
+
+		clearPosition(&pos);
+		for (int b = 0; (empties > 0) ? (NSQUARES - bitCount(pos.own | pos.opp) > empties) : (b < plies); b++)
+		{
+			bitboard_t moves = getMoves(pos.own, pos.opp);
+
+			if (moves == 0)
+			{
+				if (getMoves(pos.opp, pos.own) == 0) { break; }
+				passMove(&pos);
+				continue;
+			}
+			playMove(&pos, randomMove(moves, &rng));
+		}
+
+		// Positions with no moves are no use for the search, so go again.
+		if (getMoves(pos.own, pos.opp) == 0) { a--; continue; }
+		positions[a] = pos;
+	}
+}
+
+#define NMODES 9			// Number of search methods.
+#define PROBCUTMODE 5		// The search used by the HARD level.
+#define SOLVEMODE 6			// The first of the endgame solver methods, which are left out when comparing all of the methods.
+
+// Search methods that can be compared, with the options for each.
+static const char* modeName[NMODES] = { "alpha-beta", "pvs", "aspiration", "pvs+aspiration", "mtdf", "probcut", "solve", "solve+mtdf", "wld" };
+static const bool modePVS[NMODES] = { false, true, false, true, true, true, true, true, true };
+static const bool modeAspiration[NMODES] = { false, false, true, true, false, true, true, true, true };
+static const bool modeMTDF[NMODES] = { false, false, false, false, true, false, false, true, false };
+static const bool modeProbCut[NMODES] = { false, false, false, false, false, true, false, false, false };
+
+// Search all of the positions with one of the search methods and print a line of results.
+static void runSearch(int mode, int depth, int n, int threads, hashTable_t* hash)
+{
+	searchLimits_t limits;
+	searchResult_t result;
+	unsigned long long nodes = 0, cutoffs = 0, firstCutoffs = 0;
+	long long check = 0;
+
+	limits.depth = depth;
+	limits.millis = 0;
+	limits.pvs = modePVS[mode];
+	limits.aspiration = modeAspiration[mode];
+	limits.mtdf = modeMTDF[mode];
+	limits.probcut = modeProbCut[mode];
+	limits.solve = ((mode == SOLVEMODE) || (mode == SOLVEMODE + 1)) ? NSQUARES : 0;
+	limits.wld = (mode == SOLVEMODE + 2) ? NSQUARES : 0;
+	limits.threads = threads;
+	limits.eval = NULL;
+
+	long long start = getMillis();	// Time taken is the real time, as there can be several threads.
+	for (int a = 0; a < n; a++)
+	{
+		clearHash(hash);	// Each position starts with an empty table, so the results do not depend on the order.
+		searchPosition(&positions[a], NULL, 0, &limits, hash, &result);
+		nodes += result.nodes;
+		cutoffs += result.cutoffs;
+		firstCutoffs += result.firstCutoffs;
+		check += (long long)result.score * (a + 1);
+	}
+	double secs = (double)(getMillis() - start) / 1000.0;
+
+	printf("%-15s %14llu %9.3f %8.2f %8.1f %% %12lld\n", modeName[mode], nodes, secs, (secs > 0) ? (nodes / secs) / 1000000.0 : 0.0,
+		(cutoffs > 0) ? (100.0 * firstCutoffs) / cutoffs : 0.0, check);
+}
+
+int main(int argc, char** argv)
+{
+	int depth = 8;
+	int n = 100;
+	int hashMB = 16;
+	int empties = 0;		// Empty squares in the test positions, 0 for middle game positions.
+	int threads = 1;
+	int mode = PROBCUTMODE;		// Search method (the same as the HARD level), or -1 to compare them all.
+	hashTable_t hash;
+
+	for (int a = 1; a < argc; a++)
+	{
+		if ((strcmp(argv[a], "-n") == 0) && (a + 1 < argc))      { n = atoi(argv[++a]); }
+		else if ((strcmp(argv[a], "-h") == 0) && (a + 1 < argc)) { hashMB = atoi(argv[++a]); }
+		else if ((strcmp(argv[a], "-e") == 0) && (a + 1 < argc)) { empties = atoi(argv[++a]); }
+		else if ((strcmp(argv[a], "-t") == 0) && (a + 1 < argc)) { threads = atoi(argv[++a]); }
+		else if ((strcmp(argv[a], "-m") == 0) && (a + 1 < argc))
+		{
+			const char* name = argv[++a];
+
+			mode = -2;
+			if (strcmp(name, "all") == 0) { mode = -1; }
+			for (int m = 0; m < NMODES; m++)
+			{
+				if (strcmp(name, modeName[m]) == 0) { mode = m; }
+			}
+		}
+		else { depth = atoi(argv[a]); }
+	}
+	if ((depth < 1) || (depth > MAXDEPTH) || (n < 1) || (n > MAXPOSITIONS) || (hashMB < 0) || (empties < 0) || (empties > NSQUARES - 4) || (threads < 1) || (mode == -2))
+	{
+		printf("Usage: analyse [depth] [-n positions] [-h hashMB] [-e empties] [-t threads] [-m alpha-beta|pvs|aspiration|pvs+aspiration|mtdf|probcut|solve|solve+mtdf|wld|all]\n");
+		return 2;
+	}
+
+	initHash(&hash);
+	if (!resizeHash(&hash, (size_t)hashMB))
+	{
+		printf("Could not allocate %d MB for the hash table\n", hashMB);
+		return 1;
+	}
+	makePositions(n, empties);
+
+	// The score check is the same for every method if they all find the same scores (except ProbCut, which is selective, and
+	// wld, which only finds win, loss or draw).
+	printf("Search to depth %d of %d positions", depth, n);
+	if (empties > 0) { printf(" with %d empty squares", empties); }
+	printf(", hash %d MB, %d thread%s\n", hashMB, threads, (threads == 1) ? "" : "s");
+	printf("method               positions      secs     Mn/s  1st cut  score check\n");
+	for (int m = 0; m < NMODES; m++)
+	{
+		if (((mode == -1) && (m < SOLVEMODE)) || (mode == m)) { runSearch(m, depth, n, threads, &hash); }
+	}
+	freeHash(&hash);
+	return 0;
+}
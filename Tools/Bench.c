@@ -0,0 +1,484 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Bench
+//*
+//* Host program to measure how fast the engine functions run, so that changes to them can be compared.
+//* A fixed set of positions is made by random play, then each function is run over the whole set many times.
+//*
+//************************************************************************************************************************
+#include <stdio.h>			// For printf.
+#include <stdlib.h>			// For atoi.
+#include <time.h>			// For clock.
+
+#include "Bitboard.h"		// Engine bitboard functions.
+#include "Playout.h"		// Random playouts.
+#include "Stable.h"		// Stable pieces.
+
+#define NPOSITIONS 10000	// Number of positions in the test set.
+#define STABLEGAMES 4		// Random games played out from each position to check the stable pieces.
+
+position_t positions[NPOSITIONS];	// Test set of positions.
+
+// The test set again as separate arrays (structure of arrays) for the batch functions, with one entry per valid move for flips.
+#define NMOVES (NPOSITIONS * 20)
+bitboard_t batchOwn[NPOSITIONS], batchOpp[NPOSITIONS], batchMoves[NPOSITIONS];
+int moveSq[NMOVES];
+bitboard_t moveOwn[NMOVES], moveOpp[NMOVES], moveFlips[NMOVES];
+int nmoves = 0;
+
+// Simple random number generator, so the test set is the same on every machine.
+static uint64_t seed = 88172645463325252ULL;
+
+static unsigned int nextTestRandom(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (unsigned int)(seed >> 32);
+}
+
+// Fill the test set with positions from random games, taking every position along the way.
+static void makePositions(void)
+{
+	position_t pos;
+	int n = 0;
+
+	clearPosition(&pos);
+	while (n < NPOSITIONS)
+	{
+		bitboard_t moves = getMoves(pos.own, pos.opp);
+
+		if (moves == 0)
+		{
+			passMove(&pos);
+			moves = getMoves(pos.own, pos.opp);
+			if (moves == 0) { clearPosition(&pos); continue; }	// Game over, start another.
+		}
+		positions[n++] = pos;
+
+		// Pick a random move from the valid moves.
+		for (int a = nextTestRandom() % bitCount(moves); a > 0; a--) { moves &= moves - 1; }
+		playMove(&pos, firstSquare(moves));
+	}
+}
+
+// Count the empty squares next to a piece in pieces, or the pieces next to an empty square, square by square to check the bitboard versions.
+static int countNextTo(bitboard_t from, bitboard_t to)
+{
+	int n = 0;
+
+	for (int sq = 0; sq < NSQUARES; sq++)
+	{
+		bool found = false;
+
+		if ((from & SQUAREBIT(sq)) == 0) { continue; }
+		for (int dy = -1; dy <= 1; dy++)
+		{
+			for (int dx = -1; dx <= 1; dx++)
+			{
+				int x = SQUAREX(sq) + dx;
+				int y = SQUAREY(sq) + dy;
+
+				if (((dx != 0) || (dy != 0)) && (x >= 1) && (x <= BOARDSIZE) && (y >= 1) && (y <= BOARDSIZE) && (to & SQUAREBIT(SQUARE(x, y)))) { found = true; }
+			}
+		}
+		if (found) { n++; }
+	}
+	return n;
+}
+
+// Time the evaluation terms over the test set, returning millions of positions per second.
+static double timeTerms(int reps, bitboard_t* check)
+{
+	bitboard_t sum = 0;
+	clock_t start = clock();
+
+	for (int r = 0; r < reps; r++)
+	{
+		for (int n = 0; n < NPOSITIONS; n++)
+		{
+			sum += getMobility(positions[n].own, positions[n].opp) + getPotentialMobility(positions[n].own, positions[n].opp) +
+				getFrontier(positions[n].own, positions[n].opp);
+		}
+	}
+
+	double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+	*check = sum;	// Keep the result so the compiler cannot skip the work.
+	return ((double)reps * NPOSITIONS) / (secs * 1000000.0);
+}
+
+// Time finding the stable pieces of both players on the whole test set.
+static double timeStable(int reps, bitboard_t* check)
+{
+	bitboard_t sum = 0;
+	clock_t start = clock();
+
+	for (int r = 0; r < reps; r++)
+	{
+		for (int n = 0; n < NPOSITIONS; n++)
+		{
+			sum += getStable(positions[n].own, positions[n].opp) | getStable(positions[n].opp, positions[n].own);
+		}
+	}
+
+	double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+	*check = sum;	// Keep the result so the compiler cannot skip the work.
+	return ((double)reps * NPOSITIONS) / (secs * 1000000.0);
+}
+
+// Time random playouts from the positions in the test set, returning thousands of playouts per second.
+static double timePlayouts(bool weighted, int reps, int* check)
+{
+	rng_t rng;
+	int sum = 0;
+
+	seedRandom(&rng, 1);
+	clock_t start = clock();
+
+	for (int r = 0; r < reps; r++)
+	{
+		for (int n = 0; n < NPOSITIONS; n++) { sum += playout(&positions[n], &rng, weighted); }
+	}
+
+	double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+	*check = sum;	// Keep the result so the compiler cannot skip the work.
+	return ((double)reps * NPOSITIONS) / (secs * 1000.0);
+}
+
+// Split the test set into the arrays for the batch functions.
+static void makeBatches(void)
+{
+	for (int n = 0; n < NPOSITIONS; n++)
+	{
+		batchOwn[n] = positions[n].own;
+		batchOpp[n] = positions[n].opp;
+		for (bitboard_t moves = getMoves(positions[n].own, positions[n].opp); moves && (nmoves < NMOVES); moves &= moves - 1)
+		{
+			moveSq[nmoves] = firstSquare(moves);
+			moveOwn[nmoves] = positions[n].own;
+			moveOpp[nmoves] = positions[n].opp;
+			nmoves++;
+		}
+	}
+}
+
+// Time a batch function over the test set, returning millions of positions (or moves) per second.
+static double timeBatch(bool flips, void (*movesBatch)(int, const bitboard_t*, const bitboard_t*, bitboard_t*),
+	void (*flipsBatch)(int, const int*, const bitboard_t*, const bitboard_t*, bitboard_t*), int reps)
+{
+	clock_t start = clock();
+
+	for (int r = 0; r < reps; r++)
+	{
+		if (flips) { flipsBatch(nmoves, moveSq, moveOwn, moveOpp, moveFlips); }
+		else { movesBatch(NPOSITIONS, batchOwn, batchOpp, batchMoves); }
+	}
+
+	double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+	return ((double)reps * (flips ? nmoves : NPOSITIONS)) / (secs * 1000000.0);
+}
+
+// Time a move generator over the test set, returning millions of positions per second.
+static double timeMoves(bitboard_t (*generator)(bitboard_t, bitboard_t), int reps, bitboard_t* check)
+{
+	bitboard_t sum = 0;
+	clock_t start = clock();
+
+	for (int r = 0; r < reps; r++)
+	{
+		for (int n = 0; n < NPOSITIONS; n++)
+		{
+			sum += generator(positions[n].own, positions[n].opp);
+		}
+	}
+
+	double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+	*check = sum;	// Keep the result so the compiler cannot skip the work.
+	return ((double)reps * NPOSITIONS) / (secs * 1000000.0);
+}
+
+// Time a flip generator over every valid move of every position in the test set, returning millions of moves per second.
+static double timeFlips(bitboard_t (*generator)(int, bitboard_t, bitboard_t), int reps, bitboard_t* check)
+{
+	bitboard_t sum = 0;
+	long moveCount = 0;
+	clock_t start = clock();
+
+	for (int r = 0; r < reps; r++)
+	{
+		for (int n = 0; n < NPOSITIONS; n++)
+		{
+			bitboard_t moves = getMoves(positions[n].own, positions[n].opp);
+
+			while (moves)
+			{
+				sum += generator(firstSquare(moves), positions[n].own, positions[n].opp);
+				moves &= moves - 1;
+				moveCount++;
+			}
+		}
+	}
+
+	double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+	*check = sum;	// Keep the result so the compiler cannot skip the work.
+	return (double)moveCount / (secs * 1000000.0);
+}
+
+// Check one version of the batch functions gives the same answers as one position at a time. Returns false if not.
+static bool checkBatches(bool avx2)
+{
+	if (avx2)
+	{
+		getMovesBatchAVX2(NPOSITIONS, batchOwn, batchOpp, batchMoves);
+		getFlipsBatchAVX2(nmoves, moveSq, moveOwn, moveOpp, moveFlips);
+	}
+	else
+	{
+		getMovesBatchScalar(NPOSITIONS, batchOwn, batchOpp, batchMoves);
+		getFlipsBatchScalar(nmoves, moveSq, moveOwn, moveOpp, moveFlips);
+	}
+	for (int n = 0; n < NPOSITIONS; n++)
+	{
+		if (batchMoves[n] != getMovesScalar(batchOwn[n], batchOpp[n]))
+		{
+			printf("Batch move generation (%s) does not match on position %d\n", avx2 ? "AVX2" : "scalar", n);
+			return false;
+		}
+	}
+	for (int n = 0; n < nmoves; n++)
+	{
+		if (moveFlips[n] != getFlipsScalar(moveSq[n], moveOwn[n], moveOpp[n]))
+		{
+			printf("Batch flips (%s) do not match on move %d\n", avx2 ? "AVX2" : "scalar", n);
+			return false;
+		}
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	int reps = (argc > 1) ? atoi(argv[1]) : 200;	// Number of times to go through the test set.
+	bitboard_t check1, check2;
+
+	bool avx2 = hasAVX2();	// The AVX2 versions can only be checked (or run at all) on a processor that has it.
+
+	makePositions();
+	makeBatches();
+
+	// Check the move generators agree on every position before timing them.
+	for (int n = 0; n < NPOSITIONS; n++)
+	{
+		if ((getMovesScalar(positions[n].own, positions[n].opp) != getMovesRayWalk(positions[n].own, positions[n].opp)) ||
+			(avx2 && (getMovesAVX2(positions[n].own, positions[n].opp) != getMovesRayWalk(positions[n].own, positions[n].opp))))
+		{
+			printf("Move generators disagree on position %d\n", n);
+			return 1;
+		}
+	}
+
+	// Check the flip functions agree on every valid move.
+	for (int n = 0; n < NPOSITIONS; n++)
+	{
+		for (bitboard_t moves = getMoves(positions[n].own, positions[n].opp); moves; moves &= moves - 1)
+		{
+			int sq = firstSquare(moves);
+			bitboard_t flips = getFlipsRayWalk(sq, positions[n].own, positions[n].opp);
+
+			if ((getFlipsScalar(sq, positions[n].own, positions[n].opp) != flips) || (avx2 && (getFlipsAVX2(sq, positions[n].own, positions[n].opp) != flips)))
+			{
+				printf("Flip functions disagree on position %d square %d\n", n, sq);
+				return 1;
+			}
+		}
+	}
+
+	// Check both versions of the batch functions give the same answers as one position at a time.
+	if (!checkBatches(false) || (avx2 && !checkBatches(true))) { return 1; }
+
+	// Check the keys kept up to date move by move match keys worked out from scratch.
+	for (int n = 0; n < NPOSITIONS; n++)
+	{
+		position_t pos = positions[n];
+
+		setKeys(&pos);
+		if ((pos.key != positions[n].key) || (pos.swapKey != positions[n].swapKey))
+		{
+			printf("Zobrist keys do not match on position %d\n", n);
+			return 1;
+		}
+	}
+
+	// Check the potential mobility and frontier counts against a square by square count.
+	for (int n = 0; n < NPOSITIONS; n++)
+	{
+		bitboard_t empty = ~(positions[n].own | positions[n].opp);
+
+		if ((getPotentialMobility(positions[n].own, positions[n].opp) != countNextTo(empty, positions[n].opp)) ||
+			(getFrontier(positions[n].own, positions[n].opp) != countNextTo(positions[n].own, empty)))
+		{
+			printf("Evaluation terms do not match on position %d\n", n);
+			return 1;
+		}
+	}
+
+	// Check the symmetries: each can be undone, moves are moved with the board and all 8 versions have the same canonical position.
+	for (int n = 0; n < NPOSITIONS; n++)
+	{
+		position_t canon, other;
+		int t0 = canonicalPosition(&positions[n], &canon);
+
+		for (int t = 0; t < 8; t++)
+		{
+			position_t pos = positions[n];
+
+			pos.own = transformBitboard(pos.own, t);
+			pos.opp = transformBitboard(pos.opp, t);
+			setKeys(&pos);
+
+			int t1 = canonicalPosition(&pos, &other);
+			bitboard_t moves = getMoves(positions[n].own, positions[n].opp);
+
+			if ((untransformBitboard(pos.own, t) != positions[n].own) || (getMoves(pos.own, pos.opp) != transformBitboard(moves, t)) ||
+				(other.own != canon.own) || (other.opp != canon.opp) || (other.key != canon.key) ||
+				(untransformBitboard(canon.own, t0) != positions[n].own) || (untransformBitboard(other.own, t1) != pos.own) ||
+				(moves && (untransformSquare(transformSquare(firstSquare(moves), t), t) != firstSquare(moves))))
+			{
+				printf("Symmetry %d does not match on position %d\n", t, n);
+				return 1;
+			}
+		}
+	}
+
+	// Check that making and taking back every valid move gives back the same position.
+	for (int n = 0; n < NPOSITIONS; n++)
+	{
+		moveStack_t stack;
+
+		startStack(&stack, &positions[n]);
+		for (bitboard_t moves = getMoves(positions[n].own, positions[n].opp); moves; moves &= moves - 1)
+		{
+			makeMove(&stack, firstSquare(moves));
+			unmakeMove(&stack);
+			if ((stack.pos.own != positions[n].own) || (stack.pos.opp != positions[n].opp) || (stack.pos.key != positions[n].key) || (stack.ply != 0))
+			{
+				printf("Make and unmake do not match on position %d square %d\n", n, firstSquare(moves));
+				return 1;
+			}
+		}
+	}
+
+	// Check that stable pieces are not flipped by any move, and that a corner is always stable. Then play random games out
+	// to the end from each position, checking after every move that both players still hold all of their stable pieces.
+	rng_t stableRng;
+
+	seedRandom(&stableRng, 2);
+	for (int n = 0; n < NPOSITIONS; n++)
+	{
+		bitboard_t own = positions[n].own;
+		bitboard_t opp = positions[n].opp;
+		bitboard_t stable = getStable(own, opp);
+		bitboard_t oppStable = getStable(opp, own);
+		bitboard_t corners = SQUAREBIT(SQUARE(1, 1)) | SQUAREBIT(SQUARE(BOARDSIZE, 1)) | SQUAREBIT(SQUARE(1, BOARDSIZE)) | SQUAREBIT(SQUARE(BOARDSIZE, BOARDSIZE));
+		bool ok = ((stable & ~own) == 0) && ((own & corners & ~stable) == 0) && ((oppStable & ~opp) == 0);
+
+		for (bitboard_t moves = getMoves(opp, own); moves && ok; moves &= moves - 1)
+		{
+			if (getFlips(firstSquare(moves), opp, own) & stable) { ok = false; }
+		}
+		for (int g = 0; (g < STABLEGAMES) && ok; g++)
+		{
+			position_t pos = positions[n];
+			bool swapped = false;	// Set when the player to move is the opponent of the position.
+
+			for (;;)
+			{
+				bitboard_t moves = getMoves(pos.own, pos.opp);
+
+				if (moves != 0) { playMove(&pos, (g & 1) ? weightedRandomMove(moves, &stableRng) : randomMove(moves, &stableRng)); }
+				else if (getMoves(pos.opp, pos.own) != 0) { passMove(&pos); }
+				else { break; }
+				swapped = !swapped;
+
+				bitboard_t ownNow = swapped ? pos.opp : pos.own;
+				bitboard_t oppNow = swapped ? pos.own : pos.opp;
+
+				if (((stable & ~ownNow) != 0) || ((oppStable & ~oppNow) != 0))
+				{
+					ok = false;
+					break;
+				}
+			}
+		}
+		if (!ok)
+		{
+			printf("Stable pieces are not right on position %d\n", n);
+			return 1;
+		}
+	}
+
+	// Check the playouts finish with a score that can happen, and that a game already over scores its pieces as they are.
+	rng_t rng;
+
+	seedRandom(&rng, 1);
+	for (int n = 0; n < NPOSITIONS; n++)
+	{
+		int score = playout(&positions[n], &rng, (n & 1) != 0);
+		bool over = (getMoves(positions[n].own, positions[n].opp) == 0) && (getMoves(positions[n].opp, positions[n].own) == 0);
+
+		if ((score < -NSQUARES) || (score > NSQUARES) || (over && (score != bitCount(positions[n].own) - bitCount(positions[n].opp))))
+		{
+			printf("Playout score %d is not right on position %d\n", score, n);
+			return 1;
+		}
+	}
+
+	double walk = timeMoves(getMovesRayWalk, reps / 10 + 1, &check1);
+	double fill = timeMoves(getMovesScalar, reps, &check2);
+
+	printf("Move generation (%d positions)\n", NPOSITIONS);
+	printf("  ray walk      %8.2f Mpos/s\n", walk);
+	printf("  Kogge-Stone   %8.2f Mpos/s  (x%.1f)\n", fill, fill / walk);
+
+	if (avx2)
+	{
+		double simd = timeMoves(getMovesAVX2, reps, &check2);
+		printf("  AVX2          %8.2f Mpos/s  (x%.1f)\n", simd, simd / walk);
+	}
+
+	walk = timeFlips(getFlipsRayWalk, reps / 10 + 1, &check1);
+	fill = timeFlips(getFlipsScalar, reps / 10 + 1, &check2);
+
+	printf("Flips (every valid move)\n");
+	printf("  ray walk      %8.2f Mmoves/s\n", walk);
+	printf("  flip kernels  %8.2f Mmoves/s  (x%.1f)\n", fill, fill / walk);
+
+	if (avx2)
+	{
+		double simd = timeFlips(getFlipsAVX2, reps / 10 + 1, &check2);
+		printf("  AVX2          %8.2f Mmoves/s  (x%.1f)\n", simd, simd / walk);
+	}
+
+	printf("Batches of positions (structure of arrays)\n");
+	printf("  moves         %8.2f Mpos/s\n", timeBatch(false, getMovesBatchScalar, getFlipsBatchScalar, reps));
+	printf("  flips         %8.2f Mmoves/s\n", timeBatch(true, getMovesBatchScalar, getFlipsBatchScalar, reps / 10 + 1));
+	if (avx2)
+	{
+		printf("  AVX2 moves    %8.2f Mpos/s\n", timeBatch(false, getMovesBatchAVX2, getFlipsBatchAVX2, reps));
+		printf("  AVX2 flips    %8.2f Mmoves/s\n", timeBatch(true, getMovesBatchAVX2, getFlipsBatchAVX2, reps / 10 + 1));
+	}
+
+	printf("Evaluation terms (mobility, potential mobility and frontier)\n");
+	printf("  bitboards     %8.2f Mpos/s\n", timeTerms(reps, &check2));
+	printf("  stable pieces %8.2f Mpos/s\n", timeStable(reps / 10 + 1, &check2));
+
+	int result;
+
+	printf("Random playouts to the end of the game\n");
+	printf("  uniform       %8.2f Kgames/s\n", timePlayouts(false, reps / 100 + 1, &result));
+	printf("  weighted      %8.2f Kgames/s\n", timePlayouts(true, reps / 100 + 1, &result));
+	return 0;
+}
@@ -0,0 +1,187 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Calibrate
+//*
+//* Host program that writes Source/ProbCut.h, the Multi-ProbCut lines used by the search.
+//* The engine plays games against itself (with some random moves so the games are all different), and positions are
+//* taken from them spread over all stages of the game. Each position is searched to every depth up to the deepest, then
+//* for each depth and stage a straight line is fitted (least squares) to predict the deep score from the shallow one.
+//*
+//* Usage: calibrate [positions] [deepest depth]
+//* Run "make probcut" in the Tools folder to rebuild the header. It takes a few minutes with the default settings.
+//*
+//************************************************************************************************************************
+#include <stdio.h>			// For printf.
+#include <stdlib.h>			// For atoi and malloc.
+#include <math.h>			// For sqrt.
+
+#include "Search.h"			// Computer move search.
+#include "Playout.h"		// Random moves for the self-play games.
+
+#define SELFPLAYDEPTH 2		// Depth the engine searches to in the self-play games.
+#define RANDOMMOVES   8		// One move in this many is random in the self-play games.
+#define MINSAMPLES   20		// Fewest positions a line is fitted to, otherwise there is no fit for that depth and stage.
+
+// Depth of the shallow search used to predict a deep search.
+static int shallowDepth(int depth)
+{
+	return depth / 2;
+}
+
+// Search a position to exactly the depth, with the same search as the game but no ProbCut (which is being calibrated).
+static int searchScore(const position_t* pos, int depth, hashTable_t* hash)
+{
+	searchLimits_t limits = { depth, 0, true, true, false, false, 0, 0, 1, NULL };
+	searchResult_t result;
+
+	clearHash(hash);
+	searchPosition(pos, NULL, 0, &limits, hash, &result);
+	return result.score;
+}
+
+// Play a self-play game until there are the number of empty squares left, returns false if the game ends before that
+// or the player to move has no moves.
+static bool selfPlay(int empties, rng_t* rng, hashTable_t* hash, position_t* pos)
+{
+	searchLimits_t limits = { SELFPLAYDEPTH, 0, true, true, false, false, 0, 0, 1, NULL };
+	searchResult_t result;
+
+	clearPosition(pos);
+	while (NSQUARES - bitCount(pos->own | pos->opp) > empties)
+	{
+		bitboard_t moves = getMoves(pos->own, pos->opp);
+
+		if (moves == 0)
+		{
+			if (getMoves(pos->opp, pos->own) == 0) { return false; }
+			passMove(pos);
+			continue;
+		}
+		if (randomBelow(rng, RANDOMMOVES) == 0)
+		{
+			playMove(pos, randomMove(moves, rng));
+		}
+		else
+		{
+			searchPosition(pos, NULL, 0, &limits, hash, &result);
+			playMove(pos, result.move);
+		}
+	}
+	return getMoves(pos->own, pos->opp) != 0;
+}
+
+int main(int argc, char** argv)
+{
+	int n = (argc > 1) ? atoi(argv[1]) : 2000;			// Number of positions.
+	int maxDepth = (argc > 2) ? atoi(argv[2]) : 10;		// Deepest search to fit.
+	hashTable_t hash;
+	rng_t rng;
+
+	if ((n < 1) || (maxDepth < 1) || (maxDepth > 30))
+	{
+		fprintf(stderr, "Usage: calibrate [positions] [deepest depth]\n");
+		return 1;
+	}
+
+	// Scores of each position at each depth, and the stage of the game of each position.
+	int* scores = (int*)malloc(sizeof(int) * n * (maxDepth + 1));
+	int* stages = (int*)malloc(sizeof(int) * n);
+
+	initHash(&hash);
+	if ((scores == NULL) || (stages == NULL) || !resizeHash(&hash, 16))
+	{
+		fprintf(stderr, "Not enough memory\n");
+		return 1;
+	}
+	seedRandom(&rng, 1958);
+
+	for (int a = 0; a < n; a++)
+	{
+		position_t pos;
+		int empties;
+
+		// Positions are spread evenly from 4 empty squares to the start of the game.
+		do
+		{
+			empties = 4 + (int)randomBelow(&rng, NSQUARES - 7);
+		} while (!selfPlay(empties, &rng, &hash, &pos));
+
+		stages[a] = probCutStage(empties);
+		for (int d = 1; d <= maxDepth; d++) { scores[(a * (maxDepth + 1)) + d] = searchScore(&pos, d, &hash); }
+		if ((a % 100) == 99) { fprintf(stderr, "%d positions\n", a + 1); }
+	}
+
+	printf("//************************************************************************************************************************\n");
+	printf("//* Othello\t\t\tMartin Butler\tNovember 2025\n");
+	printf("//*\n");
+	printf("//* Game to play Othello against the computer.\n");
+	printf("//*\n");
+	printf("//* ProbCut header.\n");
+	printf("//*\n");
+	printf("//* GENERATED BY Tools/Calibrate.c, DO NOT EDIT. Multi-ProbCut lines for each stage and depth of the %dx%d game,\n", BOARDSIZE, BOARDSIZE);
+	printf("//* fitted to %d positions from self-play games.\n", n);
+	printf("//*\n");
+	printf("//************************************************************************************************************************\n");
+	printf("#pragma once\n");
+	printf("\n");
+	printf("#include \"Search.h\"\t\t// Multi-ProbCut types.\n");
+	printf("\n");
+	printf("#define MPCMAXDEPTH %d\t// Deepest search with a fit.\n", maxDepth);
+	printf("\n");
+	printf("// Shallow depth, slope (times 1024), offset and sigma for each stage (from the end of the game) and depth.\n");
+	printf("static const probCut_t probCut[MPCSTAGES][MPCMAXDEPTH + 1] =\n");
+	printf("{\n");
+	for (int stage = 0; stage < MPCSTAGES; stage++)
+	{
+		printf("\t{\n");
+		for (int d = 0; d <= maxDepth; d++)
+		{
+			int shallow = shallowDepth(d);
+			double sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0, syy = 0.0;
+			int count = 0;
+			int a = 0, b = 0, sigma = 0;
+
+			for (int p = 0; (shallow > 0) && (p < n); p++)
+			{
+				if (stages[p] != stage) { continue; }
+
+				double x = scores[(p * (maxDepth + 1)) + shallow];
+				double y = scores[(p * (maxDepth + 1)) + d];
+
+				sx += x;
+				sy += y;
+				sxx += x * x;
+				sxy += x * y;
+				syy += y * y;
+				count++;
+			}
+
+			// Least squares line, and the spread of the deep scores about it.
+			if ((count >= MINSAMPLES) && ((count * sxx) - (sx * sx) > 0.0))
+			{
+				double slope = ((count * sxy) - (sx * sy)) / ((count * sxx) - (sx * sx));
+				double offset = (sy - (slope * sx)) / count;
+				double residual = (syy - (2.0 * slope * sxy) - (2.0 * offset * sy) + (slope * slope * sxx) + (2.0 * slope * offset * sx) + (count * offset * offset)) / count;
+
+				a = (int)((slope * 1024.0) + 0.5);
+				b = (int)floor(offset + 0.5);
+				sigma = (int)(sqrt((residual > 0.0) ? residual : 0.0) + 0.5);
+			}
+			if (a <= 0) { shallow = 0; a = 0; b = 0; sigma = 0; }	// No usable fit.
+
+			printf("\t\t{ %2d, %4d, %4d, %4d },\t// Depth %d", shallow, a, b, sigma, d);
+			if (shallow > 0) { printf(", %d positions", count); }
+			printf("\n");
+		}
+		printf("\t},\n");
+	}
+	printf("};\n");
+
+	free(scores);
+	free(stages);
+	freeHash(&hash);
+	return 0;
+}
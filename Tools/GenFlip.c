@@ -0,0 +1,149 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* GenFlip
+//*
+//* Host program that writes Source/FlipKernels.h, which has a specialised flip function for each of the 64 squares.
+//* Given a board size of 6 or 10 it writes the functions for that size instead, for FlipKernels6.h or FlipKernels10.h.
+//* Each function only looks in the directions that can flip pieces from its square, and the line masks for those
+//* directions are written in as constants, so working out the flips for a move is a handful of mask operations.
+//*
+//* Run "make kernels" in the Tools folder to rebuild the header after changing this program.
+//*
+//************************************************************************************************************************
+#include <stdio.h>			// For printf.
+#include <stdlib.h>			// For atoi.
+#include <stdint.h>			// For 64-bit integer types.
+
+static int size = 8;		// Number of columns and rows on the board.
+
+// Line mask, with two halves for the 100 squares of the 10x10 board.
+typedef struct mask mask_t;
+
+struct mask
+{
+	uint64_t lo;	// Squares 0-63.
+	uint64_t hi;	// Squares 64-127.
+};
+
+// Column and row steps for the 8 directions, with the first four moving to higher square numbers.
+static const int dirX[8] = { 1,  0,  1, -1, -1,  0, -1,  1 };
+static const int dirY[8] = { 0,  1,  1,  1,  0, -1, -1, -1 };
+static const char* dirName[8] = { "Right", "Down", "Down and right", "Down and left", "Left", "Up", "Up and left", "Up and right" };
+
+// Get the mask of squares along a direction from (but not including) the square at column x and row y, both counted from 0.
+static mask_t lineMask(int x, int y, int d, int* length)
+{
+	mask_t mask = { 0, 0 };
+
+	*length = 0;
+	for (x = x + dirX[d], y = y + dirY[d]; (x >= 0) && (x < size) && (y >= 0) && (y < size); x = x + dirX[d], y = y + dirY[d])
+	{
+		int sq = (y * size) + x;
+
+		if (sq < 64) { mask.lo |= ((uint64_t)1) << sq; }
+		else         { mask.hi |= ((uint64_t)1) << (sq - 64); }
+		*length = *length + 1;
+	}
+	return mask;
+}
+
+// Write a mask as a constant. The 10x10 board needs the BITBOARD macro from Bitboard.h to make a 128-bit constant.
+static const char* constant(mask_t mask)
+{
+	static char text[64];
+
+	if (size > 8) { snprintf(text, sizeof(text), "BITBOARD(0x%016llxULL, 0x%016llxULL)", (unsigned long long)mask.hi, (unsigned long long)mask.lo); }
+	else          { snprintf(text, sizeof(text), "0x%016llxULL", (unsigned long long)mask.lo); }
+	return text;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc > 1) { size = atoi(argv[1]); }
+	if ((size != 6) && (size != 8) && (size != 10))
+	{
+		fprintf(stderr, "Usage: genflip [6|8|10]\n");
+		return 1;
+	}
+
+	printf("//************************************************************************************************************************\n");
+	printf("//* Othello\t\t\tMartin Butler\tNovember 2025\n");
+	printf("//*\n");
+	printf("//* Game to play Othello against the computer.\n");
+	printf("//*\n");
+	if (size == 8) { printf("//* FlipKernels header.\n"); }
+	else           { printf("//* FlipKernels%d header, for the %dx%d board.\n", size, size, size); }
+	printf("//*\n");
+	printf("//* GENERATED BY Tools/GenFlip.c, DO NOT EDIT. One flip function per square, selected through flipKernel[square].\n");
+	if (size != 8) { printf("//* Only included when BOARDSIZE is %d.\n", size); }
+	printf("//*\n");
+	printf("//* In each direction the nearest square that is not an opponent piece is found (the outflank square).\n");
+	printf("//* If that square holds a player piece, the opponent pieces between it and the move are flipped.\n");
+	printf("//*\n");
+	printf("//************************************************************************************************************************\n");
+	printf("#pragma once\n");
+	printf("\n");
+	printf("#include \"Bitboard.h\"\t// Bitboard types and functions.\n");
+
+	for (int sq = 0; sq < size * size; sq++)
+	{
+		int x = sq % size;
+		int y = sq / size;
+
+		printf("\n");
+		printf("// Flips for a move at x %d y %d.\n", x + 1, y + 1);
+		printf("static bitboard_t flipX%dY%d(bitboard_t own, bitboard_t opp)\n", x + 1, y + 1);
+		printf("{\n");
+		printf("\tbitboard_t flips = 0;\n");
+		printf("\tbitboard_t o, t;\n");
+
+		for (int d = 0; d < 8; d++)
+		{
+			int length;
+			mask_t mask = lineMask(x, y, d, &length);
+
+			// A line needs at least one opponent piece and a player piece after it, so short lines can never flip.
+			if (length < 2) { continue; }
+
+			printf("\n");
+			printf("\t// %s.\n", dirName[d]);
+			if (d < 4)
+			{
+				// The nearest square is the lowest set bit. Take one from it to get the squares in between.
+				printf("\to = ~opp & %s;\n", constant(mask));
+				printf("\tt = o & (0 - o) & own;\n");
+				printf("\tflips |= (t - (t != 0)) & %s;\n", constant(mask));
+			}
+			else
+			{
+				// The nearest square is the highest set bit. Square 0 is added so the search never runs on an empty mask.
+				printf("\to = (~opp & %s) | 1;\n", constant(mask));
+				printf("\tt = SQUAREBIT(lastSquare(o)) & own & %s;\n", constant(mask));
+				printf("\tflips |= (0 - (t << 1)) & %s;\n", constant(mask));
+			}
+		}
+		printf("\n");
+		printf("\treturn flips;\n");
+		printf("}\n");
+	}
+
+	// Table to select the flip function for a square.
+	printf("\n");
+	printf("// Flip function for each square.\n");
+	printf("static bitboard_t (* const flipKernel[%d])(bitboard_t own, bitboard_t opp) =\n", size * size);
+	printf("{\n");
+	for (int y = 0; y < size; y++)
+	{
+		printf("\t");
+		for (int x = 0; x < size; x++)
+		{
+			printf("flipX%dY%d%s", x + 1, y + 1, ((x == size - 1) && (y == size - 1)) ? "" : ((x == size - 1) ? "," : ", "));
+		}
+		printf("\n");
+	}
+	printf("};\n");
+	return 0;
+}
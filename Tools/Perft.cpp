@@ -0,0 +1,232 @@
+//************************************************************************************************************************
+//* Othello			Martin Butler	November 2025
+//*
+//* Game to play Othello against the computer.
+//*
+//* Perft
+//*
+//* Host program that counts the leaf positions of every sequence of moves to a given depth (perft) from the start of the game.
+//* The counts are checked against the published Othello figures, so this is a quick test that move generation, flips, make
+//* and unmake and passes are all right, and the time taken gives a nodes per second figure to compare optimisations.
+//*
+//* A move where a player has to miss a turn counts as a ply. A game that ends before the depth is reached counts as one leaf.
+//*
+//* Usage: perft [depth] [-t threads] [-h hashMB]
+//*   With more than one thread the positions a few moves in are shared out between the threads.
+//*   With a hash size the counts of positions already seen are looked up rather than counted again, for deep counts.
+//*
+//************************************************************************************************************************
+#include <stdio.h>			// For printf.
+#include <stdlib.h>			// For atoi.
+#include <string.h>			// For strcmp.
+#include <atomic>			// For sharing out the work between threads.
+#include <chrono>			// For timing.
+#include <thread>			// For the worker threads.
+#include <vector>			// For the work list and hash tables.
+
+#include "Bitboard.h"		// Positions and moves. Only the move generation is used, not the engine and its hash table.
+
+// Published perft counts for Othello from the starting position, from depth 0. These are for the 8x8 board only.
+#if BOARDSIZE == 8
+static const unsigned long long published[] =
+{
+	1ULL, 4ULL, 12ULL, 56ULL, 244ULL, 1396ULL, 8200ULL, 55092ULL, 390216ULL, 3005288ULL, 24571284ULL, 212258800ULL,
+	1939886636ULL, 18429641748ULL, 184042084512ULL
+};
+#define NPUBLISHED ((int)(sizeof(published) / sizeof(published[0])))
+#else
+static const unsigned long long published[1] = { 1ULL };
+#define NPUBLISHED 0
+#endif
+
+// Hash table entry holding the count for a position at a depth.
+struct perftEntry
+{
+	uint64_t key;				// Zobrist key of the position.
+	unsigned long long count;	// Number of leaves below it.
+	int depth;					// Depth it was counted to, 0 for an empty entry.
+};
+
+// Work for one thread, with its own hash table so that no locking is needed.
+struct worker
+{
+	std::vector<perftEntry> hash;	// Empty if hashing is off.
+	uint64_t mask;					// Number of hash entries less one.
+};
+
+// Count the leaves to the depth from the position on the top of the stack.
+static unsigned long long perft(moveStack_t* stack, int depth, worker* w)
+{
+	bitboard_t moves = getMoves(stack->pos.own, stack->pos.opp);
+	unsigned long long count = 0;
+
+	if (depth == 0) { return 1; }
+
+	if (moves == 0)
+	{
+		// With no moves for either player the game has ended, otherwise the player misses a turn.
+		if (getMoves(stack->pos.opp, stack->pos.own) == 0) { return 1; }
+		makeMove(stack, PASS);
+		count = perft(stack, depth - 1, w);
+		unmakeMove(stack);
+		return count;
+	}
+
+	// One move from the end the count is just the number of moves.
+	if (depth == 1) { return bitCount(moves); }
+
+	perftEntry* e = NULL;
+	if (!w->hash.empty())
+	{
+		e = &w->hash[stack->pos.key & w->mask];
+		if ((e->key == stack->pos.key) && (e->depth == depth)) { return e->count; }
+	}
+
+	for (; moves; moves &= moves - 1)
+	{
+		makeMove(stack, firstSquare(moves));
+		count += perft(stack, depth - 1, w);
+		unmakeMove(stack);
+	}
+
+	if (e != NULL)
+	{
+		e->key = stack->pos.key;
+		e->count = count;
+		e->depth = depth;
+	}
+	return count;
+}
+
+// Collect the positions a number of plies from the start, to be shared between the threads.
+// Games that have ended are kept as they are, as they count as one leaf whatever the depth.
+static void split(moveStack_t* stack, int plies, std::vector<position_t>* work)
+{
+	bitboard_t moves = getMoves(stack->pos.own, stack->pos.opp);
+
+	if ((plies == 0) || ((moves == 0) && (getMoves(stack->pos.opp, stack->pos.own) == 0)))
+	{
+		work->push_back(stack->pos);
+		return;
+	}
+	if (moves == 0)
+	{
+		makeMove(stack, PASS);
+		split(stack, plies - 1, work);
+		unmakeMove(stack);
+		return;
+	}
+	for (; moves; moves &= moves - 1)
+	{
+		makeMove(stack, firstSquare(moves));
+		split(stack, plies - 1, work);
+		unmakeMove(stack);
+	}
+}
+
+// Count to the depth using the threads, each taking the next position from the work list until there are none left.
+static unsigned long long countThreaded(const position_t* start, int depth, std::vector<worker>& workers)
+{
+	std::vector<position_t> work;
+	std::vector<std::thread> threads;
+	std::atomic<size_t> next(0);
+	std::atomic<unsigned long long> total(0);
+	moveStack_t stack;
+	int plies = 0;
+
+	// Go far enough in for plenty of positions per thread, so that they all finish at about the same time.
+	startStack(&stack, start);
+	do
+	{
+		plies++;
+		work.clear();
+		split(&stack, plies, &work);
+	} while ((work.size() < workers.size() * 16) && (plies < depth - 1));
+
+	for (size_t t = 0; t < workers.size(); t++)
+	{
+		threads.push_back(std::thread([&, t]()
+		{
+			moveStack_t s;
+			unsigned long long count = 0;
+
+			for (size_t n = next++; n < work.size(); n = next++)
+			{
+				startStack(&s, &work[n]);
+				count += perft(&s, depth - plies, &workers[t]);
+			}
+			total += count;
+		}));
+	}
+	for (size_t t = 0; t < threads.size(); t++) { threads[t].join(); }
+	return total;
+}
+
+int main(int argc, char** argv)
+{
+	int maxDepth = 11;	// Count to each depth up to this one.
+	int nthreads = 1;
+	int hashMB = 0;
+	bool ok = true;
+	position_t start;
+
+	for (int a = 1; a < argc; a++)
+	{
+		if ((strcmp(argv[a], "-t") == 0) && (a + 1 < argc))      { nthreads = atoi(argv[++a]); }
+		else if ((strcmp(argv[a], "-h") == 0) && (a + 1 < argc)) { hashMB = atoi(argv[++a]); }
+		else { maxDepth = atoi(argv[a]); }
+	}
+	if (nthreads < 1) { nthreads = 1; }
+	if ((maxDepth < 1) || (maxDepth >= MAXPLY))
+	{
+		printf("Usage: perft [depth] [-t threads] [-h hashMB]\n");
+		return 2;
+	}
+
+	// Each thread has an equal share of the hash memory, rounded down to a power of two number of entries.
+	std::vector<worker> workers(nthreads);
+	if (hashMB > 0)
+	{
+		size_t entries = 1;
+		while (entries * 2 * sizeof(perftEntry) <= ((size_t)hashMB << 20) / nthreads) { entries *= 2; }
+		for (int t = 0; t < nthreads; t++)
+		{
+			workers[t].hash.assign(entries, perftEntry());
+			workers[t].mask = entries - 1;
+		}
+	}
+
+	// Start from the same position as a new game.
+	clearPosition(&start);
+
+	printf("Perft from the %dx%d starting position, %d thread%s, hash %d MB\n", BOARDSIZE, BOARDSIZE, nthreads, (nthreads == 1) ? "" : "s", hashMB);
+	printf("depth            leaves      secs     Mn/s\n");
+	for (int depth = 1; depth <= maxDepth; depth++)
+	{
+		auto begin = std::chrono::steady_clock::now();
+		unsigned long long count;
+
+		if ((nthreads == 1) || (depth < 4))
+		{
+			moveStack_t stack;
+
+			startStack(&stack, &start);
+			count = perft(&stack, depth, &workers[0]);
+		}
+		else
+		{
+			count = countThreaded(&start, depth, workers);
+		}
+
+		double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+		const char* check = "";
+
+		if (depth < NPUBLISHED)
+		{
+			check = (count == published[depth]) ? "  ok" : "  WRONG";
+			if (count != published[depth]) { ok = false; }
+		}
+		printf("%5d %17llu %9.3f %8.2f%s\n", depth, count, secs, (secs > 0) ? (count / secs) / 1000000.0 : 0.0, check);
+	}
+	return ok ? 0 : 1;
+}